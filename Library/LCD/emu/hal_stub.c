@@ -0,0 +1,169 @@
+/*
+ * Minimal STM32 HAL stand-in for host builds.
+ * SPI transfers are decoded using the current CS/DC pin levels and fed to the
+ * controller emulator byte by byte, exactly as they would appear on the bus.
+ * Every transfer and peripheral reconfiguration is also reported to the timing model.
+ * DMA transfers are left pending and sent on the next EMU_DMAPoll(), so the source
+ * buffer is read after the caller has returned, as it would be by the real DMA.
+ */
+#include <time.h>
+#include "main.h"
+#include "st77xx_emu.h"
+
+static SPI_TypeDef spi1_regs;
+static DMA_Channel_TypeDef dma_tx_regs;
+static DMA_HandleTypeDef hdma_spi1_tx = { .Instance = &dma_tx_regs, .State = HAL_DMA_STATE_READY };
+SPI_HandleTypeDef hspi1 = { .Instance = &spi1_regs, .hdmatx = &hdma_spi1_tx, .State = HAL_SPI_STATE_READY };
+
+GPIO_TypeDef emu_port_dc, emu_port_cs, emu_port_rst, emu_port_bl;
+CoreDebug_Type emu_coredebug;
+uint32_t SystemCoreClock = 72000000;
+static DWT_Type dwt;
+
+static struct{
+  SPI_HandleTypeDef *hspi;                  // NULL when no DMA transfer is in flight
+  const uint8_t *data;
+  uint16_t size;
+  uint8_t inc;
+}dma_pending;
+
+static void STUB_LatchPort(GPIO_TypeDef *port)
+{
+  uint32_t bsrr = port->BSRR;
+  if(!bsrr){
+    return;
+  }
+  port->ODR |= bsrr & 0xFFFF;
+  port->ODR &= ~(bsrr >> 16);
+  port->BSRR = 0;
+  if(port==&emu_port_dc){
+    EMU_SetDC((port->ODR & LCD_DC_Pin) ? 1 : 0);
+  }
+  else if(port==&emu_port_cs){
+    EMU_SetCS((port->ODR & LCD_CS_Pin) ? 1 : 0);
+  }
+  else if(port==&emu_port_rst && !(port->ODR & LCD_RST_Pin)){
+    EMU_Reset();
+  }
+}
+
+/* BSRR writes can't be trapped, so every pin access and bus transfer first applies the writes made since the last one */
+static void STUB_LatchPins(void)
+{
+  STUB_LatchPort(&emu_port_rst);
+  STUB_LatchPort(&emu_port_dc);
+  STUB_LatchPort(&emu_port_cs);
+  STUB_LatchPort(&emu_port_bl);
+}
+
+GPIO_TypeDef *EMU_GPIO(GPIO_TypeDef *port)
+{
+  STUB_LatchPins();
+  return port;
+}
+
+static void STUB_Send(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size, uint8_t inc, uint8_t dma)
+{
+  STUB_LatchPins();
+  EMU_Transfer(Size, hspi->Init.DataSize==SPI_DATASIZE_16BIT ? 16 : 8, dma);
+  for(uint32_t i=0; i<Size; i++){
+    if(hspi->Init.DataSize==SPI_DATASIZE_16BIT){
+      uint16_t w = ((const uint16_t*)pData)[inc ? i : 0];
+      EMU_Write(w>>8);
+      EMU_Write(w&0xFF);
+    }
+    else{
+      EMU_Write(pData[inc ? i : 0]);
+    }
+  }
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+  (void)Timeout;
+  if(hspi->State!=HAL_SPI_STATE_READY){
+    return HAL_BUSY;
+  }
+  STUB_Send(hspi, pData, Size, 1, 0);
+  return HAL_OK;
+}
+
+__attribute__((weak)) void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  (void)hspi;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size)
+{
+  if(hspi->State!=HAL_SPI_STATE_READY){
+    return HAL_BUSY;
+  }
+  STUB_LatchPins();
+  dma_pending.hspi = hspi;
+  dma_pending.data = pData;
+  dma_pending.size = Size;
+  dma_pending.inc = hspi->hdmatx->Init.MemInc==DMA_MINC_ENABLE;
+  hspi->State = HAL_SPI_STATE_BUSY_TX;
+  hspi->hdmatx->State = HAL_DMA_STATE_BUSY;
+  return HAL_OK;
+}
+
+/* Finishes the pending DMA transfer and runs the transfer complete callback, which may start the next one */
+void EMU_DMAPoll(void)
+{
+  SPI_HandleTypeDef *hspi = dma_pending.hspi;
+  if(!hspi){
+    return;
+  }
+  dma_pending.hspi = NULL;
+  STUB_Send(hspi, dma_pending.data, dma_pending.size, dma_pending.inc, 1);
+  hspi->hdmatx->State = HAL_DMA_STATE_READY;
+  hspi->State = HAL_SPI_STATE_READY;
+  HAL_SPI_TxCpltCallback(hspi);
+}
+
+void EMU_SPIDisable(SPI_HandleTypeDef *hspi)
+{
+  hspi->Instance->CR1 &= ~SPI_CR1_SPE;
+  EMU_Reconfig(0);
+}
+
+void EMU_DMADisable(DMA_HandleTypeDef *hdma)
+{
+  hdma->Instance->CCR &= ~DMA_CCR_EN;
+  EMU_Reconfig(1);
+}
+
+DWT_Type *EMU_DWT(void)
+{
+  dwt.CYCCNT = (uint32_t)(emu.clock_ns*SystemCoreClock/1000000000ULL);
+  return &dwt;
+}
+
+HAL_DMA_StateTypeDef HAL_DMA_GetState(DMA_HandleTypeDef *hdma)
+{
+  EMU_DMAPoll();
+  return hdma->State;
+}
+
+uint32_t HAL_GetTick(void)
+{
+  struct timespec ts;
+  EMU_DMAPoll();
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(ts.tv_sec*1000 + ts.tv_nsec/1000000);
+}
+
+void HAL_Delay(uint32_t ms)
+{
+  (void)ms;
+  EMU_DMAPoll();
+}
+
+void __disable_irq(void)
+{
+}
+
+void __enable_irq(void)
+{
+}
@@ -0,0 +1,560 @@
+/*
+ * Host test bench for the LCD driver.
+ *
+ * Runs lcd.c unmodified on top of the HAL stub, draws a set of scenes and checks
+ * the image the emulated controller ends up showing against a plain software
+ * render (pset only, no drivers). Prints the bus statistics and the predicted
+ * bus time for every primitive and scene.
+ *
+ * Both renders run the same uGUI code, so this checks the accelerated drivers
+ * against pset. A change in uGUI itself draws the same on both sides and isn't
+ * caught, check the saved emu_*.ppm images for that.
+ *
+ * The pixel kernels built for the host (SSE2 on x86) are checked against their
+ * _C versions first, on the lengths and alignments the scenes may not hit.
+ *
+ * usage: lcd_emu [SPI clock in MHz] [bench]
+ * bench runs LCD_Bench() instead, cycles are derived from the predicted bus time.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lcd.h"
+#include "st77xx_emu.h"
+#include "ugui_kernel.h"
+
+static UG_GUI *lcd_gui;
+static UG_GUI ref_gui;
+static uint16_t ref_fb[LCD_HEIGHT][LCD_WIDTH];
+
+#ifdef LCD_USER_SPI_CALLBACK
+/* What an application that owns the callback does */
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  LCD_SPI_TxCplt(hspi);
+}
+#endif
+
+static void ref_pset(UG_S16 x, UG_S16 y, UG_COLOR c)
+{
+  if(x<0 || y<0 || x>=LCD_WIDTH || y>=LCD_HEIGHT){
+    return;
+  }
+  ref_fb[y][x] = c;
+}
+
+static UG_DEVICE ref_device = {
+    .x_dim = LCD_WIDTH,
+    .y_dim = LCD_HEIGHT,
+    .pset = ref_pset,
+};
+
+typedef struct{
+  const char *name;
+  void (*draw)(void);
+  void (*close)(void);
+}scene_t;
+
+static uint32_t scene_bad;                  // Mismatches found by the scene itself, added to the final compare
+static uint32_t compare(void);
+
+static void prim_fill_screen(void)
+{
+  UG_FillScreen(C_BLUE);
+}
+
+static void prim_fill_frame(void)
+{
+  UG_FillFrame(20, 20, 119, 69, C_RED);
+}
+
+static void prim_hline(void)
+{
+  UG_DrawLine(10, 100, 200, 100, C_WHITE);
+}
+
+static void prim_line(void)
+{
+  UG_DrawLine(10, 10, 200, 120, C_YELLOW);
+}
+
+static void prim_circle(void)
+{
+  UG_DrawCircle(120, 70, 40, C_GREEN);
+}
+
+static void prim_fill_circle(void)
+{
+  UG_FillCircle(120, 70, 40, C_MAGENTA);
+}
+
+static void prim_round_frame(void)
+{
+  UG_FillRoundFrame(30, 30, 180, 110, 12, C_ORANGE);
+}
+
+static void prim_triangle(void)
+{
+  UG_FillTriangle(20, 120, 200, 20, 150, 130, C_CYAN);
+}
+
+static void prim_text_small(void)
+{
+  LCD_PutStr(10, 10, "Hello Steve!", FONT_6X8, C_WHITE, C_BLACK);
+}
+
+static void prim_text_big(void)
+{
+  LCD_PutStr(10, 30, "Hello", FONT_arial_49X57, C_WHITE, C_BLACK);
+}
+
+static void prim_bmp(void)
+{
+  UG_DrawBMP(0, 0, &fry);
+}
+
+static void scene_fill(void)
+{
+  UG_FillScreen(C_WHITE);
+  UG_FillFrame(10, 10, 100, 60, C_RED);
+}
+
+static void scene_lines(void)
+{
+  UG_FillScreen(C_BLACK);
+  UG_DrawLine(10, 30, 10, 100, C_WHITE);
+  UG_DrawLine(10, 30, 100, 30, C_WHITE);
+  UG_DrawLine(10, 30, 100, 100, C_WHITE);
+  UG_DrawLine(200, 10, 20, 60, C_YELLOW);
+  UG_DrawLine(150, 200, 170, 20, C_CYAN);
+  UG_DrawMesh(120, 120, 200, 180, 7, C_GREEN);
+}
+
+static void scene_shapes(void)
+{
+  UG_FillScreen(C_NAVY);
+  UG_DrawFrame(5, 5, 60, 50, C_WHITE);
+  UG_DrawRoundFrame(70, 5, 140, 60, 8, C_YELLOW);
+  UG_FillRoundFrame(150, 5, 230, 60, 10, C_ORANGE);
+  UG_DrawCircle(45, 120, 30, C_WHITE);
+  UG_FillCircle(120, 120, 30, C_RED);
+  UG_DrawArc(200, 120, 25, 0x3C, C_GREEN);
+  UG_DrawTriangle(10, 230, 100, 170, 60, 235, C_WHITE);
+  UG_FillTriangle(120, 230, 220, 170, 170, 235, C_MAGENTA);
+}
+
+static void scene_text(void)
+{
+  UG_FillScreen(C_BLACK);
+  UG_FontSetTransparency(0);
+  LCD_PutStr(10, 5, "Hello Steve!", FONT_6X8, C_CYAN, C_BLACK);
+  LCD_PutStr(10, 20, "Hello Steve!", FONT_12X20, C_ORANGE_RED, C_BLUE);
+  LCD_PutStr(10, 45, "Hello", FONT_arial_49X57, C_CYAN, C_BLACK);
+#ifdef UGUI_USE_FONT_arial_49X57_RLE
+  LCD_PutStr(160, 45, "42", FONT_arial_49X57_RLE, C_CYAN, C_BLACK);
+#endif
+  LCD_PutStr(10, 110, "Привет!", FONT_arial_25X28_CYRILLIC, C_WHITE, C_DARK_GREEN);
+  UG_FontSetTransparency(1);
+  UG_FillFrame(10, 150, 200, 200, C_RED);
+  LCD_PutStr(12, 155, "Transparent", FONT_arial_20X23, C_YELLOW, C_BLACK);
+  UG_FontSetTransparency(0);
+}
+
+static void scene_ball(void)                      // One frame of the LCD_Test() bouncing ball, the README FPS figure
+{
+  UG_FillFrame(60, 60, 100, 100, C_BLACK);
+  UG_FillCircle(82, 82, 20, C_WHITE);
+  LCD_PutStr(0, 0, "60FPS", FONT_6X8, C_RED, C_BLACK);
+}
+
+static void scene_bmp(void)
+{
+  UG_FillScreen(0x4b10);
+  UG_DrawBMP((LCD_WIDTH-fry.width)/2, (LCD_HEIGHT-fry.height)/2, &fry);
+}
+
+#define MAX_OBJECTS 10
+static UG_WINDOW window_1;
+static UG_BUTTON button_1;
+static UG_TEXTBOX textbox_1;
+static UG_PROGRESS pgb;
+static UG_OBJECT obj_buff_wnd_1[MAX_OBJECTS];
+
+static void window_1_callback(UG_MESSAGE *msg)
+{
+  (void)msg;
+}
+
+static void scene_window(void)
+{
+  UG_WindowCreate(&window_1, obj_buff_wnd_1, MAX_OBJECTS, window_1_callback);
+  UG_WindowSetTitleText(&window_1, "Test Window");
+  UG_WindowSetTitleTextFont(&window_1, FONT_6X8);
+  UG_WindowSetTitleHeight(&window_1, 15);
+  UG_WindowSetXStart(&window_1, 0);
+  UG_WindowSetYStart(&window_1, 0);
+  UG_WindowSetXEnd(&window_1, LCD_WIDTH-1);
+  UG_WindowSetYEnd(&window_1, LCD_HEIGHT-1);
+  UG_ButtonCreate(&window_1, &button_1, BTN_ID_0, 5, 5, 70, 35);
+  UG_ButtonSetFont(&window_1, BTN_ID_0, FONT_6X8);
+  UG_ButtonSetForeColor(&window_1, BTN_ID_0, C_BLACK);
+  UG_ButtonSetBackColor(&window_1, BTN_ID_0, C_LIGHT_GRAY);
+  UG_ButtonSetText(&window_1, BTN_ID_0, "3D Btn");
+  UG_TextboxCreate(&window_1, &textbox_1, TXB_ID_0, 10, 40, LCD_WIDTH-20, 65);
+  UG_TextboxSetFont(&window_1, TXB_ID_0, FONT_6X8);
+  UG_TextboxSetText(&window_1, TXB_ID_0, "Some Text");
+  UG_TextboxSetBackColor(&window_1, TXB_ID_0, C_LIGHT_YELLOW);
+  UG_TextboxSetForeColor(&window_1, TXB_ID_0, C_BLACK);
+  UG_TextboxSetAlignment(&window_1, TXB_ID_0, ALIGN_CENTER);
+  UG_ProgressCreate(&window_1, &pgb, PGB_ID_0, 10, 72, LCD_WIDTH-20, 85);
+  UG_ProgressSetForeColor(&window_1, PGB_ID_0, C_ROYAL_BLUE);
+  UG_ProgressSetProgress(&window_1, PGB_ID_0, 40);
+  UG_WindowShow(&window_1);
+  UG_Update();
+}
+
+static void scene_window_close(void)
+{
+  UG_WindowHide(&window_1);
+  UG_WindowDelete(&window_1);
+}
+
+/* Draws a second frame while the first is still being sent. With a framebuffer the panel must
+   keep the first one, drawing has to wait for the transfers still reading the areas it touches */
+static void scene_overlap_frame(void)
+{
+  UG_FillScreen(C_NAVY);
+  UG_FillCircle(LCD_WIDTH/2, LCD_HEIGHT/2, 40, C_YELLOW);
+  UG_PutString(5, 5, "frame 1");
+}
+
+static void scene_overlap(void)
+{
+  scene_overlap_frame();
+  UG_Update();
+  UG_FillScreen(C_RED);
+  UG_FillFrame(20, 20, LCD_WIDTH-20, LCD_HEIGHT-20, C_GREEN);
+#if defined LCD_LOCAL_FB || defined LCD_BAND_FB
+  if(UG_GetGUI()==lcd_gui){
+    LCD_FlushQueue();
+    scene_bad += compare();                 // ref_fb already holds the first frame
+  }
+#endif
+  scene_overlap_frame();
+}
+
+static void scene_partial(void)
+{
+  LCD_PutStr(100, 100, "42", FONT_12X20, C_WHITE, C_BLACK);
+  UG_DrawPixel(5, 5, C_RED);
+  UG_DrawPixel(200, 220, C_RED);
+}
+
+static void scene_clip(void)                      // Everything crosses the clip rectangle or the screen edges
+{
+  UG_FillScreen(C_BLACK);
+  UG_PushClip(20, 30, 190, 170);
+  UG_FillScreen(C_DARK_BLUE);
+  UG_DrawBMP(-40, 100, &fry);
+  UG_FillCircle(10, 40, 30, C_RED);
+  UG_DrawCircle(180, 160, 25, C_WHITE);
+  UG_FillRoundFrame(150, 10, 230, 60, 8, C_GREEN);
+  UG_DrawLine(0, 0, LCD_WIDTH-1, LCD_HEIGHT-1, C_YELLOW);
+  UG_DrawLine(5, 90, 230, 90, C_CYAN);
+  UG_FillTriangle(100, 0, 200, 120, 60, 200, C_ORANGE);
+  LCD_PutStr(120, 20, "Clip", FONT_12X20, C_WHITE, C_BLACK);
+  UG_FontSetTransparency(1);
+  LCD_PutStr(-8, 160, "Clipped text", FONT_arial_20X23, C_YELLOW, C_BLACK);
+  UG_FontSetTransparency(0);
+  UG_PushClip(60, 60, 120, 120);
+  UG_FillCircle(90, 90, 50, C_MAGENTA);
+  UG_PopClip();
+  UG_PopClip();
+  UG_FillCircle(-10, -10, 30, C_WHITE);           // Negative centre, still partly on screen
+  UG_DrawBMP(LCD_WIDTH-30, LCD_HEIGHT-30, &fry);
+}
+
+static void scene_blit(void)                      // Parts of a bitmap, like a sprite sheet
+{
+  UG_FillScreen(C_BLACK);
+  for(int i=0; i<6; i++)
+    UG_DrawBMPArea(i*40, 0, &fry, i*10, i*12, i*10+31, i*12+39);
+  UG_DrawBMPArea(-10, 60, &fry, 20, 20, 76, 113);
+  UG_DrawBMPArea(200, 150, &fry, -5, -5, 200, 200);  // Source area bigger than the image
+  UG_PushClip(100, 100, 150, 140);
+  UG_DrawBMPArea(90, 90, &fry, 0, 30, 76, 100);
+  UG_PopClip();
+}
+
+static void scene_rle(void)                       // Run length encoded image, whole, clipped and in parts
+{
+  UG_FillScreen(C_BLACK);
+  UG_DrawBMP(0, 0, &fry_rle);
+  UG_DrawBMP(LCD_WIDTH-40, 100, &fry_rle);
+  UG_DrawBMPArea(80, 0, &fry_rle, 0, 50, 76, 113);
+  UG_DrawBMPArea(80, 120, &fry_rle, 10, 20, 60, 80);
+  UG_PushClip(150, 10, 190, 60);
+  UG_DrawBMP(140, 0, &fry_rle);
+  UG_PopClip();
+}
+
+/* Small indexed icons, odd widths so the rows end inside a byte */
+static const uint16_t icon_pal[16] = {
+    C_BLACK, C_WHITE, C_RED, C_LIME, C_BLUE, C_YELLOW, C_CYAN, C_MAGENTA,
+    C_GRAY, C_ORANGE, C_NAVY, C_OLIVE, C_TEAL, C_MAROON, C_PINK, C_GOLD,
+};
+static const uint8_t icon1_data[] = {                       // 13x12, 1bpp
+    0x00, 0x00, 0x02, 0x00, 0x1f, 0xc0, 0x3f, 0xe0, 0x3f, 0xe0, 0x3f, 0xe0, 0x60, 0x30, 0x3f, 0xe0,
+    0x3f, 0xe0, 0x3f, 0xe0, 0x1f, 0xc0, 0x02, 0x00,
+};
+static const uint8_t icon2_data[] = {                       // 12x12, 2bpp
+    0xff, 0xaa, 0xff, 0xfa, 0xaa, 0xaf, 0xea, 0x55, 0xab, 0xe9, 0x55, 0x6b, 0xa5, 0x41, 0x5a, 0xa5,
+    0x00, 0x5a, 0xa5, 0x00, 0x5a, 0xa5, 0x41, 0x5a, 0xe9, 0x55, 0x6b, 0xea, 0x55, 0xab, 0xfa, 0xaa,
+    0xaf, 0xff, 0xaa, 0xff,
+};
+static const uint8_t icon4_data[] = {                       // 11x10, 4bpp
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xd0, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xe0, 0x56, 0x78,
+    0x9a, 0xbc, 0xde, 0xf0, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x00, 0x78, 0x9a, 0xbc, 0xde, 0xf0, 0x10,
+    0x89, 0xab, 0xcd, 0xef, 0x01, 0x20, 0x9a, 0xbc, 0xde, 0xf0, 0x12, 0x30,
+};
+static UG_BMP icon1 = { .p=icon1_data, .width=13, .height=12, .bpp=BMP_BPP_1, .colors=BMP_RGB565, .palette=&icon_pal[1] };
+static UG_BMP icon2 = { .p=icon2_data, .width=12, .height=12, .bpp=BMP_BPP_2, .colors=BMP_RGB565, .palette=&icon_pal[2] };
+static UG_BMP icon4 = { .p=icon4_data, .width=11, .height=10, .bpp=BMP_BPP_4, .colors=BMP_RGB565, .palette=icon_pal };
+
+static void scene_indexed(void)                   // Palette indexed images, 1 to 8bpp, whole, clipped and in parts
+{
+  UG_FillScreen(C_BLACK);
+  UG_DrawBMP(0, 0, &fry_idx);
+  UG_DrawBMP(LCD_WIDTH-40, 100, &fry_idx);
+  UG_DrawBMPArea(80, 0, &fry_idx, 0, 50, 76, 113);
+  UG_DrawBMPArea(80, 120, &fry_idx, 9, 20, 60, 80);
+  for(int i=0; i<8; i++){
+    UG_DrawBMP(150+i*14, 70, &icon1);
+    UG_DrawBMP(150+i*14, 84, &icon2);
+    UG_DrawBMP(150+i*14, 98, &icon4);
+  }
+  UG_DrawBMPArea(-5, 200, &icon4, 3, 1, 10, 9);
+  UG_PushClip(150, 10, 190, 60);
+  UG_DrawBMP(140, 0, &fry_idx);
+  UG_PopClip();
+}
+
+#define CONSOLE_MESSAGES 60
+
+static void scene_console(void)                   // Log view. Scrolled by hardware when the rotation allows it, wrapped and cleared otherwise
+{
+  char msg[24];
+  int first = 0, lines = (LCD_HEIGHT-1-16-8)/8+1;                 // As many as the console fits without scrolling
+
+  UG_FillScreen(C_BLACK);
+  UG_FontSelect(FONT_6X8);
+  UG_ConsoleSetArea(0, 16, LCD_WIDTH-1, LCD_HEIGHT-1);
+  UG_ConsoleSetForecolor(C_LIME);
+  UG_ConsoleSetBackcolor(C_BLACK);
+  UG_ConsoleSetScroll(1);
+  if(UG_GetGUI()==&ref_gui && LCD_VScroll(-1, -1, -1)==UG_RESULT_OK){                    // The reference can't scroll, it prints only the lines left on screen
+    first = CONSOLE_MESSAGES-lines;
+  }
+  for(int i=first; i<CONSOLE_MESSAGES; i++){
+    snprintf(msg, sizeof(msg), "message %d\n", i);
+    UG_ConsolePutString(msg);
+  }
+  UG_PutString(0, 0, "Log");
+}
+
+static void scene_console_close(void)
+{
+  UG_ConsoleSetScroll(0);
+}
+
+static const scene_t prims[] = {
+    { "UG_FillScreen",     prim_fill_screen  },
+    { "UG_FillFrame",      prim_fill_frame   },
+    { "UG_DrawLine h",     prim_hline        },
+    { "UG_DrawLine",       prim_line         },
+    { "UG_DrawCircle",     prim_circle       },
+    { "UG_FillCircle",     prim_fill_circle  },
+    { "UG_FillRoundFrame", prim_round_frame  },
+    { "UG_FillTriangle",   prim_triangle     },
+    { "UG_PutString 6x8",  prim_text_small   },
+    { "UG_PutString 49x57", prim_text_big    },
+    { "UG_DrawBMP",        prim_bmp          },
+};
+
+static const scene_t scenes[] = {
+    { "fill",   scene_fill   },
+    { "ball",   scene_ball   },
+    { "lines",  scene_lines  },
+    { "shapes", scene_shapes },
+    { "text",   scene_text   },
+    { "bmp",    scene_bmp    },
+    { "partial", scene_partial },
+    { "clip",   scene_clip   },
+    { "blit",   scene_blit   },
+    { "rle",    scene_rle    },
+    { "indexed", scene_indexed },
+    { "console", scene_console, scene_console_close },
+    { "window", scene_window, scene_window_close },
+    { "overlap", scene_overlap },
+};
+
+static uint32_t compare(void)
+{
+  uint32_t bad = 0;
+  for(int y=0; y<LCD_HEIGHT; y++){
+    for(int x=0; x<LCD_WIDTH; x++){
+      if(EMU_GetDisplayPixel(x+LCD_X_SHIFT, y+LCD_Y_SHIFT) != ref_fb[y][x]){
+        bad++;
+      }
+    }
+  }
+  return bad;
+}
+
+/* Draws a scene on both GUIs and checks the result, returns the mismatched pixel count */
+static uint32_t run(const scene_t *sc)
+{
+  char path[64];
+  uint32_t bad;
+
+  UG_SelectGUI(&ref_gui);
+  sc->draw();
+  if(sc->close){
+    sc->close();
+  }
+
+  UG_SelectGUI(lcd_gui);
+  EMU_ClearStats();
+  scene_bad = 0;
+  sc->draw();
+  UG_Update();
+  LCD_FlushQueue();
+
+  bad = compare() + scene_bad;
+  EMU_PrintStats(sc->name);
+  printf("%-24s mismatched pixels: %u\n", "", bad);
+  snprintf(path, sizeof(path), "emu_%s.ppm", sc->name);
+  for(char *p=path; *p; p++){
+    if(*p==' '){
+      *p = '_';
+    }
+  }
+  EMU_WritePPM(path, LCD_X_SHIFT, LCD_Y_SHIFT, LCD_WIDTH, LCD_HEIGHT);
+  if(sc->close){
+    sc->close();
+  }
+  return bad;
+}
+
+/* Kernel edge inputs: lengths around the vector width, every alignment, coverage 0 and 255 */
+static const uint16_t kernel_lens[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 100 };
+static const uint16_t kernel_colors[] = { 0x0000, 0xFFFF, 0xF800, 0x07E0, 0x001F, 0x8410, 0x7BEF, 0x1234 };
+
+static uint8_t kernel_coverage(uint8_t pattern, uint16_t i)
+{
+  static const uint8_t edges[] = { 0, 1, 2, 3, 4, 127, 128, 251, 252, 253, 254, 255 };
+  switch(pattern){
+    case 0:  return 0;
+    case 1:  return 255;
+    case 2:  return (i&1) ? 255 : 0;
+    case 3:  return edges[i%sizeof(edges)];
+    default: return rand();
+  }
+}
+
+/* Runs the built kernels and their _C versions on the same rows, returns the mismatched pixel count.
+   The rows start at every offset in a 16 byte block and pixels past the end must stay untouched */
+static uint32_t check_kernels(void)
+{
+  uint16_t row[2][128+16], src[128+16];
+  uint32_t row32[2][128+16];
+  uint8_t cov[128+16];
+  uint32_t bad[3] = { 0, 0, 0 };
+
+  for(unsigned l=0; l<sizeof(kernel_lens)/sizeof(kernel_lens[0]); l++){
+    uint16_t n = kernel_lens[l];
+    for(uint8_t dof=0; dof<8; dof++){
+      for(uint8_t sof=0; sof<8; sof++){
+        for(unsigned c=0; c<sizeof(kernel_colors)/sizeof(kernel_colors[0]); c++){
+          uint16_t fc = kernel_colors[c], bc = kernel_colors[(c+3)%(sizeof(kernel_colors)/sizeof(kernel_colors[0]))];
+
+          if(!sof){                                                   // Fill only has a destination
+            memset(row, 0xA5, sizeof(row));
+            UG_KernelFill16(row[0]+dof, fc, n);
+            UG_KernelFill16_C(row[1]+dof, fc, n);
+            bad[0] += memcmp(row[0], row[1], sizeof(row[0]))!=0;
+          }
+
+          for(uint8_t pattern=0; pattern<5; pattern++){
+            for(uint16_t i=0; i<sizeof(cov); i++){
+              cov[i] = kernel_coverage(pattern, i);
+              row[0][i] = row[1][i] = rand();
+            }
+            UG_KernelBlend565(row[0]+dof, cov+sof, n, fc, bc);
+            UG_KernelBlend565_C(row[1]+dof, cov+sof, n, fc, bc);
+            bad[1] += memcmp(row[0], row[1], sizeof(row[0]))!=0;
+          }
+
+          for(uint16_t i=0; i<sizeof(src)/sizeof(src[0]); i++){
+            src[i] = (i&1) ? kernel_colors[(i>>1)%(sizeof(kernel_colors)/sizeof(kernel_colors[0]))] : rand();
+          }
+          memset(row32, 0xA5, sizeof(row32));
+          UG_KernelRGB565To888(row32[0]+dof, src+sof, n);
+          UG_KernelRGB565To888_C(row32[1]+dof, src+sof, n);
+          bad[2] += memcmp(row32[0], row32[1], sizeof(row32[0]))!=0;
+        }
+      }
+    }
+  }
+  printf("%-24s mismatched rows: %u\n", "UG_KernelFill16", bad[0]);
+  printf("%-24s mismatched rows: %u\n", "UG_KernelBlend565", bad[1]);
+  printf("%-24s mismatched rows: %u\n", "UG_KernelRGB565To888", bad[2]);
+  return bad[0] + bad[1] + bad[2];
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t fails = 0;
+  uint8_t bench = 0;
+
+  for(int i=1; i<argc; i++){
+    if(!strcmp(argv[i], "bench")){
+      bench = 1;
+    }
+    else{
+      emu_timing.spi_hz = atof(argv[i])*1e6;
+    }
+  }
+
+#ifdef USE_ST7735
+  EMU_Init(&emu_st7735);
+#else
+  EMU_Init(&emu_st7789);
+#endif
+  LCD_init();
+  lcd_gui = UG_GetGUI();
+  UG_Init(&ref_gui, &ref_device);
+  UG_FontSetHSpace(0);
+  UG_FontSetVSpace(0);
+
+#ifdef LCD_BENCH
+  if(bench){
+    UG_SelectGUI(lcd_gui);
+    LCD_Bench(NULL);
+    return 0;
+  }
+#endif
+
+  printf("%s, SPI clock %.1fMHz, %dx%d\n\n-- Kernels\n", emu.ctl->name, emu_timing.spi_hz/1e6, LCD_WIDTH, LCD_HEIGHT);
+  fails += check_kernels()!=0;
+  printf("\n-- Primitives\n");
+  for(unsigned i=0; i<sizeof(prims)/sizeof(prims[0]); i++){
+    fails += run(&prims[i])!=0;
+  }
+  printf("\n-- Scenes\n");
+  for(unsigned i=0; i<sizeof(scenes)/sizeof(scenes[0]); i++){
+    fails += run(&scenes[i])!=0;
+  }
+  return fails ? 1 : 0;
+}
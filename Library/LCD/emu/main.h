@@ -0,0 +1,140 @@
+/*
+ * Host-side replacement for the CubeMX generated main.h.
+ * Provides just enough of the STM32 HAL for lcd.c to build on a PC,
+ * routing every SPI/DMA transfer into the ST77xx emulator.
+ */
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+typedef enum { RESET = 0, SET = !RESET } FlagStatus, GPIO_PinState;
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+typedef enum { HAL_OK = 0, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT } HAL_StatusTypeDef;
+typedef enum { HAL_DMA_STATE_RESET = 0, HAL_DMA_STATE_READY, HAL_DMA_STATE_BUSY } HAL_DMA_StateTypeDef;
+typedef enum { HAL_SPI_STATE_RESET = 0, HAL_SPI_STATE_READY, HAL_SPI_STATE_BUSY_TX } HAL_SPI_StateTypeDef;
+
+#define HAL_MAX_DELAY               0xFFFFFFFFU
+
+/* GPIO */
+typedef struct{
+  volatile uint32_t BSRR;
+  uint32_t ODR;
+}GPIO_TypeDef;
+
+GPIO_TypeDef *EMU_GPIO(GPIO_TypeDef *port);       /* Latches the previous BSRR write before handing out the port */
+
+extern GPIO_TypeDef emu_port_dc, emu_port_cs, emu_port_rst, emu_port_bl;
+#define LCD_DC_Pin                  (1U<<0)
+#define LCD_DC_GPIO_Port            EMU_GPIO(&emu_port_dc)
+#define LCD_CS_Pin                  (1U<<1)
+#define LCD_CS_GPIO_Port            EMU_GPIO(&emu_port_cs)
+#define LCD_RST_Pin                 (1U<<2)
+#define LCD_RST_GPIO_Port           EMU_GPIO(&emu_port_rst)
+#define LCD_BL_Pin                  (1U<<3)
+#define LCD_BL_GPIO_Port            EMU_GPIO(&emu_port_bl)
+
+/* DMA, F1 style channel registers */
+typedef struct{
+  volatile uint32_t CCR;
+  volatile uint32_t CNDTR;
+}DMA_Channel_TypeDef;
+
+#define DMA_CCR_EN                  (1U<<0)
+#define DMA_CCR_MINC_Pos            7U
+#define DMA_CCR_MINC                (1U<<DMA_CCR_MINC_Pos)
+#define DMA_CCR_PSIZE_Pos           8U
+#define DMA_CCR_PSIZE_Msk           (3U<<DMA_CCR_PSIZE_Pos)
+#define DMA_CCR_MSIZE_Pos           10U
+#define DMA_CCR_MSIZE_Msk           (3U<<DMA_CCR_MSIZE_Pos)
+
+#define DMA_MINC_ENABLE             DMA_CCR_MINC
+#define DMA_MINC_DISABLE            0U
+#define DMA_PDATAALIGN_BYTE         0U
+#define DMA_PDATAALIGN_HALFWORD     (1U<<DMA_CCR_PSIZE_Pos)
+#define DMA_MDATAALIGN_BYTE         0U
+#define DMA_MDATAALIGN_HALFWORD     (1U<<DMA_CCR_MSIZE_Pos)
+
+typedef struct{
+  uint32_t MemInc;
+  uint32_t PeriphDataAlignment;
+  uint32_t MemDataAlignment;
+}DMA_InitTypeDef;
+
+typedef struct{
+  DMA_Channel_TypeDef *Instance;
+  DMA_InitTypeDef Init;
+  volatile HAL_DMA_StateTypeDef State;
+}DMA_HandleTypeDef;
+
+void EMU_DMADisable(DMA_HandleTypeDef *hdma);    /* Accounts for the reconfiguration time */
+#define __HAL_DMA_DISABLE(h)        EMU_DMADisable(h)
+HAL_DMA_StateTypeDef HAL_DMA_GetState(DMA_HandleTypeDef *hdma);
+
+/* SPI */
+typedef struct{
+  volatile uint32_t CR1;
+  volatile uint32_t SR;
+  volatile uint32_t DR;
+}SPI_TypeDef;
+
+#define SPI_CR1_SPE                 (1U<<6)
+#define SPI_CR1_DFF                 (1U<<11)
+#define SPI_SR_TXE                  (1U<<1)
+#define SPI_SR_BSY                  (1U<<7)
+#define SPI_DATASIZE_8BIT           0U
+#define SPI_DATASIZE_16BIT          SPI_CR1_DFF
+
+typedef struct{
+  uint32_t DataSize;
+}SPI_InitTypeDef;
+
+typedef struct __SPI_HandleTypeDef{
+  SPI_TypeDef *Instance;
+  SPI_InitTypeDef Init;
+  DMA_HandleTypeDef *hdmatx;
+  volatile HAL_SPI_StateTypeDef State;
+}SPI_HandleTypeDef;
+
+void EMU_SPIDisable(SPI_HandleTypeDef *hspi);
+#define __HAL_SPI_DISABLE(h)        EMU_SPIDisable(h)
+#define __HAL_SPI_ENABLE(h)         ((h)->Instance->CR1 |= SPI_CR1_SPE)
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi);
+
+/* DMA transfers only reach the emulator when the CPU waits for them, the driver's wait loops poll here */
+void EMU_DMAPoll(void);
+#define LCD_IDLE()                  EMU_DMAPoll()
+
+/* Cycle counter, CYCCNT follows the predicted bus time */
+typedef struct{
+  volatile uint32_t CTRL;
+  volatile uint32_t CYCCNT;
+}DWT_Type;
+
+typedef struct{
+  volatile uint32_t DEMCR;
+}CoreDebug_Type;
+
+DWT_Type *EMU_DWT(void);
+extern CoreDebug_Type emu_coredebug;
+#define DWT                         EMU_DWT()
+#define CoreDebug                   (&emu_coredebug)
+#define DWT_CTRL_CYCCNTENA_Msk      (1U<<0)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1U<<24)
+
+extern uint32_t SystemCoreClock;
+
+/* Core */
+void HAL_Delay(uint32_t ms);
+uint32_t HAL_GetTick(void);
+void __disable_irq(void);
+void __enable_irq(void);
+
+extern SPI_HandleTypeDef hspi1;
+
+#endif /* __MAIN_H */
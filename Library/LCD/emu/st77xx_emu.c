@@ -0,0 +1,353 @@
+/*
+ * ST7789 / ST7735 controller emulator.
+ *
+ * Consumes the raw byte stream seen on the SPI bus (CS/DC qualified) and keeps
+ * a copy of the controller GRAM plus the command state machine, so the image the
+ * panel would show can be dumped and every transfer can be accounted for.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "st77xx_emu.h"
+
+#define EMU_CASET     0x2A
+#define EMU_RASET     0x2B
+#define EMU_RAMWR     0x2C
+#define EMU_MADCTL    0x36
+#define EMU_COLMOD    0x3A
+#define EMU_VSCRDEF   0x33
+#define EMU_VSCSAD    0x37
+
+#define MADCTL_MY     0x80
+#define MADCTL_MX     0x40
+#define MADCTL_MV     0x20
+#define MADCTL_BGR    0x08
+
+const emu_controller_t emu_st7789 = { "ST7789", 240, 320, 0x66, 1 };
+const emu_controller_t emu_st7735 = { "ST7735", 132, 162, 0x06, 0 };
+
+emu_t emu = { .ctl = &emu_st7789 };
+
+emu_timing_t emu_timing = {
+    .spi_hz = 32000000,
+    .word_gap_ns = 60,
+    .call_ns = 1500,
+    .dma_setup_ns = 2500,
+    .pin_ns = 30,
+    .spi_cfg_ns = 150,
+    .dma_cfg_ns = 250,
+};
+
+/* Selects the controller model and resets it */
+void EMU_Init(const emu_controller_t *ctl)
+{
+  emu.ctl = ctl;
+  EMU_Reset();
+}
+
+/* Hardware reset, the controller model stays */
+void EMU_Reset(void)
+{
+  const emu_controller_t *ctl = emu.ctl;
+  memset(&emu, 0, sizeof(emu));
+  emu.ctl = ctl;
+  emu.cs = 1;
+  emu.dc = 1;
+  emu.sleeping = 1;
+  emu.xe = ctl->gram_width-1;
+  emu.ye = ctl->gram_height-1;
+  emu.vsa = ctl->gram_height;
+  emu.colmod = ctl->colmod;
+}
+
+static void EMU_AddTime(uint64_t ns)
+{
+  emu.stats.time_ns += ns;
+  emu.clock_ns += ns;
+}
+
+void EMU_ClearStats(void)
+{
+  memset(&emu.stats, 0, sizeof(emu.stats));
+}
+
+void EMU_SetCS(uint8_t level)
+{
+  if(emu.cs && !level){
+    emu.stats.cs_cycles++;
+  }
+  if(emu.cs != level){
+    EMU_AddTime(emu_timing.pin_ns);
+  }
+  emu.cs = level;
+}
+
+void EMU_SetDC(uint8_t level)
+{
+  if(emu.dc != level){
+    emu.stats.dc_toggles++;
+    EMU_AddTime(emu_timing.pin_ns);
+  }
+  emu.dc = level;
+}
+
+/* Accounts for the time taken by a SPI transfer of the given number of words */
+void EMU_Transfer(uint32_t words, uint8_t bits, uint8_t dma)
+{
+  uint64_t ns = ((uint64_t)words*bits*1000000000ULL + emu_timing.spi_hz-1) / emu_timing.spi_hz;
+  if(dma){
+    emu.stats.dma_calls++;
+    ns += emu_timing.dma_setup_ns;
+  }
+  else{
+    emu.stats.spi_calls++;
+    ns += emu_timing.call_ns + (uint64_t)words*emu_timing.word_gap_ns;
+  }
+  EMU_AddTime(ns);
+}
+
+/* Accounts for a SPI or DMA reconfiguration */
+void EMU_Reconfig(uint8_t dma)
+{
+  if(dma){
+    emu.stats.dma_cfg++;
+    EMU_AddTime(emu_timing.dma_cfg_ns);
+  }
+  else{
+    emu.stats.spi_cfg++;
+    EMU_AddTime(emu_timing.spi_cfg_ns);
+  }
+}
+
+/* Maps a window address to a GRAM location following MADCTL. Returns 0 if it falls outside the GRAM */
+static int EMU_Map(uint16_t c, uint16_t r, uint16_t *pc, uint16_t *pr)
+{
+  uint16_t x = c, y = r;
+  if(emu.madctl & MADCTL_MV){
+    x = r;
+    y = c;
+  }
+  if(x >= emu.ctl->gram_width || y >= emu.ctl->gram_height){
+    return 0;
+  }
+  if(emu.madctl & MADCTL_MX){
+    x = emu.ctl->gram_width-1-x;
+  }
+  if(emu.madctl & MADCTL_MY){
+    y = emu.ctl->gram_height-1-y;
+  }
+  *pc = x;
+  *pr = y;
+  return 1;
+}
+
+static void EMU_WritePixel(uint16_t color)
+{
+  uint16_t pc, pr;
+  if(EMU_Map(emu.col, emu.row, &pc, &pr)){
+    if(emu.gram[pr][pc] == color){
+      emu.stats.pixels_unchanged++;
+    }
+    emu.gram[pr][pc] = color;
+  }
+  emu.stats.pixels++;
+  if(++emu.col > emu.xe){
+    emu.col = emu.xs;
+    if(++emu.row > emu.ye){
+      emu.row = emu.ys;
+    }
+  }
+}
+
+/* 4 bit channel to 5 or 6 bits, the top bits are repeated like the controller does */
+#define EMU_4TO5(c)   (((c)<<1) | ((c)>>3))
+#define EMU_4TO6(c)   (((c)<<2) | ((c)>>2))
+
+/* Assembles pixels following the COLMOD interface format, bits 2-0. Other formats write nothing */
+static void EMU_PixelByte(uint8_t byte)
+{
+  uint8_t *p = emu.px;
+  p[emu.px_len++] = byte;
+  switch(emu.colmod & 0x07){
+    case 0x05:                                    // 16 bit, RRRRRGGG GGGBBBBB
+      if(emu.px_len==2){
+        EMU_WritePixel(((uint16_t)p[0]<<8) | p[1]);
+        emu.px_len = 0;
+      }
+      break;
+    case 0x06:                                    // 18 bit, one byte per channel, 6 top bits used
+      if(emu.px_len==3){
+        EMU_WritePixel(((uint16_t)(p[0]>>3)<<11) | ((uint16_t)(p[1]>>2)<<5) | (p[2]>>3));
+        emu.px_len = 0;
+      }
+      break;
+    case 0x03:                                    // 12 bit, two pixels in 3 bytes, RRRRGGGG BBBBRRRR GGGGBBBB
+      if(emu.px_len==3){
+        EMU_WritePixel((EMU_4TO5(p[0]>>4)<<11) | (EMU_4TO6(p[0]&0x0F)<<5) | EMU_4TO5(p[1]>>4));
+        EMU_WritePixel((EMU_4TO5(p[1]&0x0F)<<11) | (EMU_4TO6(p[2]>>4)<<5) | EMU_4TO5(p[2]&0x0F));
+        emu.px_len = 0;
+      }
+      break;
+    default:
+      emu.px_len = 0;
+      break;
+  }
+}
+
+static void EMU_Command(uint8_t cmd)
+{
+  emu.cmd = cmd;
+  emu.argc = 0;
+  emu.px_len = 0;
+  emu.stats.commands++;
+  emu.stats.cmd_count[cmd]++;
+  switch(cmd){
+    case 0x01:                                    // SWRESET
+      emu.madctl = 0;
+      emu.colmod = emu.ctl->colmod;
+      emu.inverted = 0;
+      emu.scroll_on = 0;
+      emu.sleeping = 1;
+      emu.display_on = 0;
+      break;
+    case 0x10: emu.sleeping = 1; break;           // SLPIN
+    case 0x11: emu.sleeping = 0; break;           // SLPOUT
+    case 0x13: emu.scroll_on = 0; break;          // NORON, leaves scroll mode
+    case 0x20: emu.inverted = 0; break;           // INVOFF
+    case 0x21: emu.inverted = 1; break;           // INVON
+    case 0x28: emu.display_on = 0; break;         // DISPOFF
+    case 0x29: emu.display_on = 1; break;         // DISPON
+    case EMU_RAMWR:
+      emu.col = emu.xs;
+      emu.row = emu.ys;
+      break;
+  }
+}
+
+static void EMU_Param(uint8_t data)
+{
+  if(emu.argc < sizeof(emu.args)){
+    emu.args[emu.argc] = data;
+  }
+  emu.argc++;
+  switch(emu.cmd){
+    case EMU_CASET:
+      if(emu.argc==4){
+        uint16_t xs = (emu.args[0]<<8) | emu.args[1];
+        uint16_t xe = (emu.args[2]<<8) | emu.args[3];
+        if(xs==emu.xs && xe==emu.xe){
+          emu.stats.redundant_caset++;
+        }
+        emu.xs = xs;
+        emu.xe = xe;
+      }
+      break;
+    case EMU_RASET:
+      if(emu.argc==4){
+        uint16_t ys = (emu.args[0]<<8) | emu.args[1];
+        uint16_t ye = (emu.args[2]<<8) | emu.args[3];
+        if(ys==emu.ys && ye==emu.ye){
+          emu.stats.redundant_raset++;
+        }
+        emu.ys = ys;
+        emu.ye = ye;
+      }
+      break;
+    case EMU_MADCTL:
+      if(emu.argc==1){
+        emu.madctl = data;
+      }
+      break;
+    case EMU_COLMOD:
+      if(emu.argc==1){
+        emu.colmod = data;
+      }
+      break;
+    case EMU_VSCRDEF:
+      if(emu.argc==6){
+        emu.tfa = (emu.args[0]<<8) | emu.args[1];
+        emu.vsa = (emu.args[2]<<8) | emu.args[3];
+        emu.bfa = (emu.args[4]<<8) | emu.args[5];
+      }
+      break;
+    case EMU_VSCSAD:
+      if(emu.argc==2){
+        emu.vsp = (emu.args[0]<<8) | emu.args[1];
+        emu.scroll_on = 1;
+      }
+      break;
+  }
+}
+
+void EMU_Write(uint8_t byte)
+{
+  if(emu.cs){
+    return;                                       // Not selected, the controller ignores the bus
+  }
+  if(!emu.dc){
+    EMU_Command(byte);
+    return;
+  }
+  emu.stats.data_bytes++;
+  if(emu.cmd==EMU_RAMWR){
+    EMU_PixelByte(byte);
+  }
+  else{
+    EMU_Param(byte);
+  }
+}
+
+/* Returns the color shown at a window address, after scrolling and inversion */
+uint16_t EMU_GetDisplayPixel(uint16_t x, uint16_t y)
+{
+  uint16_t pc, pr, color;
+  if(!EMU_Map(x, y, &pc, &pr)){
+    return 0;
+  }
+  if(emu.scroll_on && emu.vsa && pr>=emu.tfa && pr<emu.tfa+emu.vsa){
+    uint32_t m = emu.vsp + (pr-emu.tfa);
+    if(m >= (uint32_t)emu.tfa+emu.vsa){
+      m -= emu.vsa;
+    }
+    if(m < emu.ctl->gram_height){
+      pr = m;
+    }
+  }
+  color = emu.gram[pr][pc];
+  if(emu.inverted != emu.ctl->ips){
+    color = ~color;
+  }
+  return color;
+}
+
+/* Dumps a window of the displayed image as a binary PPM file */
+int EMU_WritePPM(const char *path, uint16_t x0, uint16_t y0, uint16_t w, uint16_t h)
+{
+  FILE *f = fopen(path, "wb");
+  if(!f){
+    return -1;
+  }
+  fprintf(f, "P6\n%u %u\n255\n", w, h);
+  for(uint16_t y=y0; y<y0+h; y++){
+    for(uint16_t x=x0; x<x0+w; x++){
+      uint16_t c = EMU_GetDisplayPixel(x, y);
+      uint8_t rgb[3] = { (c>>8)&0xF8, (c>>3)&0xFC, (c<<3)&0xF8 };
+      if(emu.madctl & MADCTL_BGR){
+        uint8_t t = rgb[0]; rgb[0] = rgb[2]; rgb[2] = t;
+      }
+      fwrite(rgb, 1, 3, f);
+    }
+  }
+  fclose(f);
+  return 0;
+}
+
+void EMU_PrintStats(const char *title)
+{
+  printf("%-24s cmds=%-6u caset=%-6u raset=%-6u ramwr=%-6u redundant=%u/%u data=%-8u px=%-8u unchanged=%-8u cs=%-6u dc=%u\n",
+         title, emu.stats.commands, emu.stats.cmd_count[EMU_CASET], emu.stats.cmd_count[EMU_RASET], emu.stats.cmd_count[EMU_RAMWR],
+         emu.stats.redundant_caset, emu.stats.redundant_raset, emu.stats.data_bytes, emu.stats.pixels,
+         emu.stats.pixels_unchanged, emu.stats.cs_cycles, emu.stats.dc_toggles);
+  printf("%-24s spi=%-6u dma=%-6u spi_cfg=%-6u dma_cfg=%-6u vscsad=%-6u time=%.3fms (%.1f fps)\n",
+         "", emu.stats.spi_calls, emu.stats.dma_calls, emu.stats.spi_cfg, emu.stats.dma_cfg, emu.stats.cmd_count[EMU_VSCSAD],
+         emu.stats.time_ns/1e6, emu.stats.time_ns ? 1e9/emu.stats.time_ns : 0.0);
+}
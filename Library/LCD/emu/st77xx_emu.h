@@ -0,0 +1,90 @@
+#ifndef __ST77XX_EMU_H__
+#define __ST77XX_EMU_H__
+
+#include <stdint.h>
+
+/* Largest controller GRAM, the emulated controller uses the top left part of it */
+#define EMU_GRAM_MAX_WIDTH      240
+#define EMU_GRAM_MAX_HEIGHT     320
+
+/* Emulated controller model */
+typedef struct{
+  const char *name;
+  uint16_t gram_width;          /* GRAM columns                                          */
+  uint16_t gram_height;         /* GRAM rows                                             */
+  uint8_t colmod;               /* Pixel format after reset                              */
+  uint8_t ips;                  /* IPS panels show inverted colors unless INVON is set   */
+}emu_controller_t;
+
+extern const emu_controller_t emu_st7789;      /* 240x320, 18 bit after reset, IPS     */
+extern const emu_controller_t emu_st7735;      /* 132x162, 18 bit after reset, TN      */
+
+/*
+ * Bus timing model. Transfers complete at once on the host, so the time they would take on the target is
+ * added up instead. Defaults roughly match a 72MHz STM32F1 with HAL drivers, adjust to the actual board.
+ */
+typedef struct{
+  uint32_t spi_hz;              /* SPI clock                                             */
+  uint32_t word_gap_ns;         /* Idle time between words in polled transfers           */
+  uint32_t call_ns;             /* HAL_SPI_Transmit() call overhead                      */
+  uint32_t dma_setup_ns;        /* HAL_SPI_Transmit_DMA() setup and completion interrupt */
+  uint32_t pin_ns;              /* CS or DC pin toggle                                   */
+  uint32_t spi_cfg_ns;          /* SPI word size change                                  */
+  uint32_t dma_cfg_ns;          /* DMA memory increase or data size change               */
+}emu_timing_t;
+
+extern emu_timing_t emu_timing;
+
+typedef struct{
+  uint32_t commands;            /* Command bytes received                                */
+  uint32_t cmd_count[256];      /* Per-command histogram                                 */
+  uint32_t data_bytes;          /* Parameter and pixel bytes received                    */
+  uint32_t pixels;              /* Pixels written to GRAM                                */
+  uint32_t pixels_unchanged;    /* Pixels written with the value already in GRAM         */
+  uint32_t redundant_caset;     /* CASET with the same window already set                */
+  uint32_t redundant_raset;     /* RASET with the same window already set                */
+  uint32_t cs_cycles;           /* CS assertions                                         */
+  uint32_t dc_toggles;          /* DC transitions                                        */
+  uint32_t spi_calls;           /* Polled SPI transfers                                  */
+  uint32_t dma_calls;           /* DMA transfers                                         */
+  uint32_t spi_cfg;             /* SPI reconfigurations                                  */
+  uint32_t dma_cfg;             /* DMA reconfigurations                                  */
+  uint64_t time_ns;             /* Predicted bus time                                    */
+}emu_stats_t;
+
+typedef struct{
+  const emu_controller_t *ctl;  /* Controller model, kept across resets                   */
+  uint16_t gram[EMU_GRAM_MAX_HEIGHT][EMU_GRAM_MAX_WIDTH];  /* RGB565, 12 and 18 bit pixels are converted */
+  uint8_t madctl;
+  uint8_t colmod;
+  uint8_t inverted;
+  uint8_t sleeping;
+  uint8_t display_on;
+  uint8_t scroll_on;
+  uint16_t xs, xe, ys, ye;      /* Current CASET/RASET window                            */
+  uint16_t col, row;            /* RAM write pointer, window coordinates                 */
+  uint16_t tfa, vsa, bfa, vsp;  /* Vertical scroll definition and start address          */
+  uint8_t cmd;                  /* Command being parsed                                  */
+  uint8_t argc;                 /* Parameters received for it                            */
+  uint8_t args[16];
+  uint8_t px[3], px_len;        /* Pixel byte assembly, up to 3 bytes depending on COLMOD */
+  uint8_t cs, dc;
+  uint64_t clock_ns;            /* Predicted bus time since reset, not cleared with the stats */
+  emu_stats_t stats;
+}emu_t;
+
+extern emu_t emu;
+
+void EMU_Init(const emu_controller_t *ctl);
+void EMU_Reset(void);
+void EMU_SetCS(uint8_t level);
+void EMU_SetDC(uint8_t level);
+void EMU_Write(uint8_t byte);
+void EMU_ClearStats(void);
+void EMU_Transfer(uint32_t words, uint8_t bits, uint8_t dma);
+void EMU_Reconfig(uint8_t dma);
+uint16_t EMU_GetDisplayPixel(uint16_t x, uint16_t y);
+int EMU_WritePPM(const char *path, uint16_t x0, uint16_t y0, uint16_t w, uint16_t h);
+void EMU_PrintStats(const char *title);
+
+#endif // __ST77XX_EMU_H__
@@ -128,3 +128,747 @@ UG_BMP fry = {
   .bpp=BMP_BPP_16,
 };
 
+
+// Same picture run length encoded with UGUI/Tools/ugui_bmp_rle.c, 2580 words
+const uint16_t fry_rle_data[2580] = {
+    0x8012, 0x4b10, 0x000b, 0xa618, 0xc6f8, 0x4b10, 0x4b10, 0xc6f8, 0xa514, 0x4b10, 0x4b10, 0xc618, 0xffff, 0xffde, 0x8510, 0x8003,
+    0x4b10, 0x0000, 0xa618, 0x8002, 0xc6f8, 0x0008, 0x4b10, 0xa514, 0xc6f8, 0xc6f8, 0xc618, 0xa514, 0x4b10, 0x4b10, 0xa514, 0x8002,
+    0xc6f8, 0x0000, 0xa514, 0x8002, 0x4b10, 0x0005, 0xc618, 0xffff, 0xffde, 0x8410, 0x4b10, 0x4b10, 0x8002, 0xc6f8, 0x0008, 0xc618,
+    0x6310, 0x4b10, 0x4b10, 0x8510, 0xffde, 0xffff, 0xc618, 0x4208, 0x8016, 0x4b10, 0x000c, 0xc6f8, 0xffff, 0x8410, 0x4b10, 0xffff,
+    0xc6f8, 0x4b10, 0xa618, 0xffff, 0xffde, 0xffde, 0xffff, 0x6310, 0x8002, 0x4b10, 0x0000, 0xffde, 0x8002, 0xffff, 0x0021, 0x4b10,
+    0xa514, 0xffff, 0xffff, 0xffde, 0xffff, 0xa618, 0x4b10, 0xc618, 0xffff, 0xffff, 0xffde, 0xffff, 0x8410, 0x4b10, 0xc618, 0xffff,
+    0xffde, 0xffde, 0xffff, 0x6308, 0x4b10, 0xffff, 0xffff, 0xffde, 0xffff, 0xffde, 0x4b10, 0x4208, 0xffde, 0xffff, 0xffde, 0xffff,
+    0xc618, 0x8016, 0x4b10, 0x000c, 0xc6f8, 0xffff, 0xc618, 0x4b10, 0xffff, 0xc618, 0x4b10, 0xffde, 0xffde, 0x8410, 0xc618, 0xffff,
+    0xa518, 0x8002, 0x4b10, 0x0025, 0xc6f8, 0xffff, 0xc6f8, 0x8510, 0x4b10, 0xc618, 0xffff, 0xffde, 0xa514, 0xffff, 0xc6f8, 0x4b10,
+    0xc618, 0xffff, 0xc6f8, 0xc618, 0xffff, 0xc618, 0x4b10, 0xffde, 0xffde, 0x8410, 0xc6f8, 0xffff, 0xa514, 0x4b10, 0xffff, 0xffde,
+    0xa514, 0xffde, 0xffde, 0x4b10, 0x6410, 0xffde, 0xffde, 0xa514, 0xffde, 0xffde, 0x8016, 0x4b10, 0x000c, 0xc618, 0xffde, 0xc6f8,
+    0x4b10, 0xffff, 0xc618, 0x4b10, 0xffde, 0xffff, 0x6310, 0xa518, 0xffff, 0xc618, 0x8002, 0x4b10, 0x0025, 0xc6f8, 0xffff, 0xa514,
+    0x4b10, 0x4b10, 0xc618, 0xffff, 0xc6f8, 0x6308, 0xffff, 0xffde, 0x4b10, 0xc618, 0xffff, 0xc618, 0x8410, 0xffde, 0xc6f8, 0x4b10,
+    0xffde, 0xffde, 0x6310, 0xc6f8, 0xffff, 0xc618, 0x4b10, 0xffff, 0xffff, 0x6308, 0xc618, 0xffff, 0x4b10, 0x8410, 0xffff, 0xffde,
+    0x6310, 0xffde, 0xc6f8, 0x8016, 0x4b10, 0x000c, 0xc618, 0xffde, 0xffde, 0x4b10, 0xffff, 0xc6f8, 0x4b10, 0xffde, 0xffff, 0x6310,
+    0xa514, 0xffff, 0xc618, 0x8002, 0x4b10, 0x0023, 0xc6f8, 0xffff, 0xc618, 0x4b10, 0x4b10, 0xc618, 0xffde, 0xc618, 0x6310, 0xffff,
+    0xffde, 0x4b10, 0xc618, 0xffff, 0xc618, 0xa514, 0xffff, 0xc6f8, 0x4b10, 0xffde, 0xffff, 0x6310, 0xc618, 0xffff, 0xc618, 0x4b10,
+    0xffff, 0xffff, 0x6310, 0xc618, 0xffff, 0x4b10, 0x6410, 0xffde, 0xffde, 0x8410, 0x8018, 0x4b10, 0x0000, 0xc6f8, 0x8003, 0xffde,
+    0x0007, 0xc618, 0x4b10, 0xffde, 0xffde, 0x6308, 0xc618, 0xffde, 0xc618, 0x8002, 0x4b10, 0x000d, 0xc6f8, 0xffff, 0xffde, 0xffde,
+    0x4b10, 0xc618, 0xffde, 0xffde, 0xc6f8, 0xffde, 0xa514, 0x4b10, 0xc618, 0xffff, 0x8002, 0xffde, 0x000f, 0x8410, 0x4b10, 0xffde,
+    0xffde, 0x6308, 0xc6f8, 0xffff, 0xc618, 0x4b10, 0xffff, 0xffde, 0xc6f8, 0xffde, 0xc6f8, 0x4b10, 0x4b10, 0x8002, 0xffde, 0x0000,
+    0xa514, 0x8017, 0x4b10, 0x000c, 0xc6f8, 0xffde, 0xffde, 0xffff, 0xffde, 0xc618, 0x4b10, 0xffde, 0xffff, 0x6308, 0xa514, 0xffde,
+    0xc618, 0x8002, 0x4b10, 0x0006, 0xc6f8, 0xffff, 0xffde, 0xffde, 0x4b10, 0xa514, 0xffff, 0x8002, 0xffde, 0x0002, 0x8410, 0x4b10,
+    0xc618, 0x8003, 0xffde, 0x0010, 0x6308, 0x4b10, 0xffde, 0xffde, 0x6308, 0xc6f8, 0xffff, 0xc618, 0x4b10, 0xffff, 0xffff, 0xffde,
+    0xffff, 0xc618, 0x4b10, 0x4b10, 0x6310, 0x8002, 0xffde, 0x0000, 0xa514, 0x8016, 0x4b10, 0x000c, 0xc6f8, 0xffff, 0xc6f8, 0xffff,
+    0xffff, 0xc618, 0x4b10, 0xffde, 0xffde, 0x6308, 0xa514, 0xffde, 0xc618, 0x8002, 0x4b10, 0x001e, 0xc6f8, 0xffff, 0xc618, 0x4208,
+    0x4b10, 0xc618, 0xffde, 0xc6f8, 0x8410, 0xffde, 0xc6f8, 0x4b10, 0xc618, 0xffde, 0xc6f8, 0xa514, 0xffff, 0xc618, 0x4b10, 0xffde,
+    0xffde, 0x6308, 0xc6f8, 0xffff, 0xc618, 0x4b10, 0xffff, 0xffff, 0x8410, 0xc6f8, 0xffff, 0x8002, 0x4b10, 0x0003, 0x4208, 0xc6f8,
+    0xffff, 0xffde, 0x8016, 0x4b10, 0x000c, 0xc618, 0xffff, 0x4b10, 0xffde, 0xffde, 0xc6f8, 0x4b10, 0xffde, 0xffff, 0x6310, 0xa514,
+    0xffff, 0xc618, 0x8002, 0x4b10, 0x0025, 0xc6f8, 0xffff, 0xa514, 0x4b10, 0x4b10, 0xa514, 0xffff, 0xc6f8, 0x4208, 0xffff, 0xffde,
+    0x4b10, 0xc618, 0xffff, 0xc618, 0x8410, 0xffff, 0xc6f8, 0x4b10, 0xffde, 0xffff, 0x6308, 0xc6f8, 0xffff, 0xc618, 0x4b10, 0xffff,
+    0xffff, 0x6308, 0xc618, 0xffff, 0x4b10, 0x6308, 0xffde, 0xc6f8, 0x8410, 0xffff, 0xffde, 0x8016, 0x4b10, 0x000c, 0xc6f8, 0xffff,
+    0x4b10, 0xffde, 0xffde, 0xc6f8, 0x4b10, 0xffde, 0xffde, 0x6310, 0xa514, 0xffde, 0xc618, 0x8002, 0x4b10, 0x0025, 0xc6f8, 0xffff,
+    0xc618, 0x4b10, 0x4b10, 0xa618, 0xffde, 0xc6f8, 0x6308, 0xffff, 0xffde, 0x4b10, 0xc618, 0xffff, 0xc618, 0x8410, 0xffff, 0xc6f8,
+    0x4b10, 0xffde, 0xffde, 0x6310, 0xc6f8, 0xffff, 0xc618, 0x4b10, 0xffff, 0xffff, 0x6308, 0xc618, 0xffff, 0x4b10, 0x6310, 0xffde,
+    0xffde, 0x6308, 0xffde, 0xffff, 0x8016, 0x4b10, 0x000c, 0xc6f8, 0xffff, 0x4b10, 0xffde, 0xffde, 0xc618, 0x4b10, 0xffde, 0xffff,
+    0xa514, 0xc6f8, 0xffff, 0xa514, 0x8002, 0x4b10, 0x0025, 0xc6f8, 0xffff, 0xffde, 0xc6f8, 0x4b10, 0xc618, 0xffff, 0xc6f8, 0x6308,
+    0xffff, 0xc6f8, 0x4b10, 0xc618, 0xffff, 0xc618, 0x8410, 0xffde, 0xc6f8, 0x4b10, 0xc6f8, 0xffff, 0xc618, 0xffde, 0xffff, 0xa514,
+    0x4b10, 0xffff, 0xffff, 0x6308, 0xc618, 0xffde, 0x4b10, 0x4208, 0xffff, 0xffde, 0xc618, 0xffff, 0xffff, 0x8016, 0x4b10, 0x000c,
+    0xc618, 0xffff, 0x4b10, 0xc618, 0xffde, 0xc618, 0x4b10, 0x8510, 0xffde, 0xffff, 0xffff, 0xffde, 0x6308, 0x8002, 0x4b10, 0x0013,
+    0xc6f8, 0xffff, 0xffde, 0xffde, 0x4b10, 0xc618, 0xffff, 0xc6f8, 0x6308, 0xffff, 0xc6f8, 0x4b10, 0xc618, 0xffde, 0xc618, 0x8410,
+    0xffde, 0xc6f8, 0x4b10, 0xa514, 0x8003, 0xffde, 0x0009, 0x4b10, 0x4b10, 0xffde, 0xffde, 0x6308, 0xc618, 0xffde, 0x4b10, 0x4b10,
+    0xc6f8, 0x8002, 0xffff, 0x0000, 0xc618, 0x8016, 0x4b10, 0x000b, 0x6310, 0x8410, 0x4b10, 0x4b10, 0x8410, 0x6310, 0x4b10, 0x4b10,
+    0x6410, 0xa514, 0xa514, 0x4308, 0x8003, 0x4b10, 0x0000, 0x6410, 0x8002, 0x8410, 0x0020, 0x4b10, 0x6310, 0x8410, 0x6410, 0x4b10,
+    0x8410, 0x8410, 0x4b10, 0x8310, 0xa410, 0x8308, 0x6208, 0xa410, 0x8310, 0x4b10, 0x4b10, 0x8410, 0xa514, 0xa514, 0x6208, 0x4b10,
+    0x4b10, 0xa410, 0xa410, 0x4108, 0x8308, 0x8410, 0x4b10, 0x4b10, 0x4208, 0xa514, 0xa514, 0x8510, 0x8032, 0x4b10, 0x0007, 0x8208,
+    0x8200, 0xa308, 0xa308, 0x8200, 0x8208, 0x6208, 0x4108, 0x8004, 0x4b10, 0x0001, 0xc408, 0x8208, 0x8002, 0xa308, 0x0000, 0x8200,
+    0x8037, 0x4b10, 0x0001, 0x4208, 0xc408, 0x8006, 0xfbe4, 0x0000, 0x6200, 0x8004, 0x4b10, 0x0000, 0xc408, 0x8004, 0xfbe4, 0x0001,
+    0xc408, 0x4208, 0x8035, 0x4b10, 0x0001, 0x4208, 0xc408, 0x8006, 0xfbe4, 0x0000, 0xc408, 0x8004, 0x4b10, 0x8006, 0xfbe4, 0x0000,
+    0x6208, 0x8035, 0x4b10, 0x0001, 0x4208, 0xa308, 0x8007, 0xfbe4, 0x0000, 0x8208, 0x8003, 0x4b10, 0x8006, 0xfbe4, 0x0001, 0xa308,
+    0x4208, 0x8021, 0x4b10, 0x0002, 0x6208, 0x6200, 0x6200, 0x8004, 0x6208, 0x0003, 0x6200, 0x6200, 0x4100, 0x6308, 0x8006, 0x4b10,
+    0x0001, 0x4208, 0xa308, 0x8008, 0xfbe4, 0x0000, 0x6200, 0x8002, 0x4b10, 0x8007, 0xfbe4, 0x0000, 0x6200, 0x801f, 0x4b10, 0x0002,
+    0x4100, 0x4100, 0xa308, 0x8009, 0xfbe4, 0x0002, 0xa308, 0x8208, 0x4208, 0x8004, 0x4b10, 0x0001, 0x4208, 0xa308, 0x8008, 0xfbe4,
+    0x0003, 0xa308, 0x4208, 0x4b10, 0x4b10, 0x8007, 0xfbe4, 0x0000, 0xc408, 0x801d, 0x4b10, 0x0002, 0x4100, 0x6100, 0xa200, 0x800e,
+    0xfbe4, 0x0006, 0xa308, 0x8308, 0x6208, 0x6308, 0x6208, 0x6100, 0xa308, 0x8009, 0xfbe4, 0x0002, 0x6208, 0x4b10, 0x4b10, 0x8008,
+    0xfbe4, 0x0000, 0x6100, 0x801c, 0x4b10, 0x0000, 0x8200, 0x8012, 0xfbe4, 0x0004, 0xc408, 0xc308, 0xa308, 0x8200, 0xc308, 0x8009,
+    0xfbe4, 0x0002, 0xc408, 0x6208, 0x6200, 0x8008, 0xfbe4, 0x0000, 0xa208, 0x801a, 0x4b10, 0x0001, 0x6200, 0xc408, 0x8023, 0xfbe4,
+    0x0001, 0xc308, 0x8100, 0x8008, 0xfbe4, 0x0001, 0xc308, 0x4100, 0x8018, 0x4b10, 0x0001, 0x4100, 0xc308, 0x8025, 0xfbe4, 0x0000,
+    0xc200, 0x8009, 0xfbe4, 0x0000, 0x8200, 0x8017, 0x4b10, 0x0001, 0x4208, 0xa308, 0x8032, 0xfbe4, 0x8017, 0x4b10, 0x0000, 0xa308,
+    0x8033, 0xfbe4, 0x0000, 0xa308, 0x8015, 0x4b10, 0x0000, 0x8208, 0x8034, 0xfbe4, 0x0000, 0xa308, 0x8014, 0x4b10, 0x0000, 0x6208,
+    0x8035, 0xfbe4, 0x0000, 0x6100, 0x800c, 0x4b10, 0x0002, 0x6100, 0xa308, 0x6100, 0x8004, 0x4b10, 0x0000, 0xa308, 0x8002, 0xfbe4,
+    0x0000, 0xe400, 0x8031, 0xfbe4, 0x0000, 0x8208, 0x800c, 0x4b10, 0x0007, 0xa308, 0xfbe4, 0xc308, 0x6208, 0x4100, 0x4b10, 0x4b10,
+    0x6100, 0x8036, 0xfbe4, 0x0000, 0xa308, 0x800b, 0x4b10, 0x0000, 0x4100, 0x8003, 0xfbe4, 0x0002, 0xa308, 0x4100, 0x6200, 0x8037,
+    0xfbe4, 0x0000, 0xc308, 0x800b, 0x4b10, 0x0000, 0xa308, 0x8004, 0xfbe4, 0x0001, 0xc308, 0xa200, 0x8038, 0xfbe4, 0x0000, 0x6100,
+    0x800a, 0x4b10, 0x0001, 0x4100, 0xa308, 0x803e, 0xfbe4, 0x0000, 0xa308, 0x800a, 0x4b10, 0x0004, 0x4100, 0xa308, 0xfbe4, 0xfbe4,
+    0xe400, 0x803b, 0xfbe4, 0x0000, 0x6100, 0x800b, 0x4b10, 0x0000, 0x4100, 0x803e, 0xfbe4, 0x0000, 0x6208, 0x800b, 0x4b10, 0x0000,
+    0xa308, 0x803e, 0xfbe4, 0x0000, 0x6100, 0x800a, 0x4b10, 0x0000, 0x4100, 0x803f, 0xfbe4, 0x0000, 0x6208, 0x8009, 0x4b10, 0x0000,
+    0x4100, 0x8013, 0xfbe4, 0x0002, 0xc200, 0xa200, 0xa300, 0x8002, 0xc308, 0x8020, 0xfbe4, 0x0000, 0xe400, 0x8004, 0xfbe4, 0x0000,
+    0x6208, 0x8006, 0x4b10, 0x0001, 0xa308, 0xa308, 0x8014, 0xfbe4, 0x0009, 0xe308, 0xc408, 0xe410, 0xc410, 0xc408, 0xc408, 0xc308,
+    0xc308, 0xa308, 0xa308, 0x8002, 0xc308, 0x801f, 0xfbe4, 0x0000, 0x6100, 0x8006, 0x4b10, 0x0001, 0x6100, 0xc408, 0x8002, 0xfbe4,
+    0x0001, 0xe400, 0xe400, 0x8011, 0xfbe4, 0x0001, 0xa200, 0xe510, 0x8004, 0xfdb2, 0x0008, 0xe510, 0xe510, 0xe410, 0xc408, 0xc308,
+    0xa308, 0xa200, 0xc200, 0xc308, 0x801b, 0xfbe4, 0x0000, 0xa308, 0x8005, 0x4b10, 0x0000, 0x6100, 0x8019, 0xfbe4, 0x0002, 0xa200,
+    0xfdb2, 0xe510, 0x8008, 0xfdb2, 0x0003, 0xe510, 0xe408, 0xa308, 0x8200, 0x801a, 0xfbe4, 0x0000, 0x6208, 0x8005, 0x4b10, 0x0000,
+    0xa308, 0x801a, 0xfbe4, 0x0001, 0xa308, 0xe510, 0x800c, 0xfdb2, 0x0003, 0xfbe4, 0xc308, 0xa208, 0xa200, 0x8015, 0xfbe4, 0x8007,
+    0x4b10, 0x0001, 0x6100, 0xc408, 0x8019, 0xfbe4, 0x0002, 0xc308, 0xa308, 0xe510, 0x800e, 0xfdb2, 0x0000, 0xe510, 0x8002, 0xfbe4,
+    0x0001, 0xc300, 0xc300, 0x8010, 0xfbe4, 0x8007, 0x4b10, 0x0002, 0x6208, 0x6100, 0x8208, 0x8019, 0xfbe4, 0x0001, 0xc308, 0xc408,
+    0x8011, 0xfdb2, 0x8003, 0xe510, 0x0003, 0xa308, 0xa200, 0xa300, 0xc308, 0x800a, 0xfbe4, 0x0000, 0xa308, 0x800a, 0x4b10, 0x0002,
+    0x6100, 0x8200, 0xc308, 0x8017, 0xfbe4, 0x0001, 0xa200, 0xe510, 0x8016, 0xfdb2, 0x0004, 0xc408, 0xa308, 0xa200, 0xa200, 0xc300,
+    0x8005, 0xfbe4, 0x0000, 0xc308, 0x800e, 0x4b10, 0x0002, 0x6208, 0x6200, 0xc308, 0x800d, 0xfbe4, 0x0000, 0x8100, 0x8002, 0xc308,
+    0x0000, 0xe308, 0x8003, 0xfbe4, 0x0000, 0xc308, 0x8018, 0xfdb2, 0x0009, 0xe510, 0xe510, 0xc408, 0xc308, 0xc308, 0xa208, 0x8200,
+    0x6200, 0x6208, 0x6208, 0x800f, 0x4b10, 0x0001, 0x6208, 0x8200, 0x800d, 0xfbe4, 0x0005, 0xc308, 0xc308, 0xe510, 0xe408, 0xc308,
+    0xa200, 0x8002, 0xfbe4, 0x0001, 0xa308, 0xe510, 0x801c, 0xfdb2, 0x0002, 0xe510, 0x6100, 0x6308, 0x8012, 0x4b10, 0x0000, 0xa308,
+    0x800e, 0xfbe4, 0x0009, 0xa300, 0xe510, 0xfdb2, 0xfdb2, 0xe510, 0xc308, 0xa200, 0xc308, 0xa308, 0xe510, 0x801e, 0xfdb2, 0x8012,
+    0x4b10, 0x0001, 0x6208, 0xc408, 0x800f, 0xfbe4, 0x0001, 0xa200, 0xe510, 0x8002, 0xfdb2, 0x0003, 0xe510, 0xa308, 0x8208, 0xe510,
+    0x801c, 0xfdb2, 0x0001, 0xe510, 0xc510, 0x8012, 0x4b10, 0x0000, 0x6208, 0x8010, 0xfbe4, 0x0001, 0xc308, 0xa308, 0x8004, 0xfdb2,
+    0x0001, 0xe510, 0xe510, 0x801e, 0xfdb2, 0x0000, 0x8308, 0x8011, 0x4b10, 0x0000, 0xa408, 0x8011, 0xfbe4, 0x0001, 0xc308, 0xe510,
+    0x8025, 0xfdb2, 0x8010, 0x4b10, 0x0000, 0x6208, 0x8013, 0xfbe4, 0x0000, 0x8200, 0x8025, 0xfdb2, 0x8010, 0x4b10, 0x0000, 0x8208,
+    0x8013, 0xfbe4, 0x0001, 0xc308, 0xc308, 0x8024, 0xfdb2, 0x8010, 0x4b10, 0x0000, 0xa308, 0x8014, 0xfbe4, 0x0000, 0xa208, 0x8023,
+    0xfdb2, 0x0001, 0xe510, 0xe510, 0x800f, 0x4b10, 0x0000, 0xc308, 0x8014, 0xfbe4, 0x0001, 0xc308, 0xc308, 0x8023, 0xfdb2, 0x0001,
+    0xe510, 0x8308, 0x800e, 0x4b10, 0x8016, 0xfbe4, 0x0000, 0x8200, 0x8015, 0xfdb2, 0x0002, 0xe510, 0xc410, 0xc410, 0x800c, 0xfdb2,
+    0x800d, 0x4b10, 0x0000, 0x6100, 0x8016, 0xfbe4, 0x0001, 0xc308, 0xe410, 0x8015, 0xfdb2, 0x0002, 0xe510, 0xc408, 0xc410, 0x800d,
+    0xfdb2, 0x800b, 0x4b10, 0x0000, 0x8200, 0x8017, 0xfbe4, 0x0001, 0xa308, 0xe510, 0x8016, 0xfdb2, 0x0001, 0xa308, 0xe510, 0x800d,
+    0xfdb2, 0x0000, 0x8310, 0x8009, 0x4b10, 0x8018, 0xfbe4, 0x0001, 0xc308, 0xe510, 0x8016, 0xfdb2, 0x0001, 0xe510, 0xa308, 0x800e,
+    0xfdb2, 0x0000, 0x4208, 0x8008, 0x4b10, 0x8018, 0xfbe4, 0x0001, 0xc308, 0xc408, 0x8017, 0xfdb2, 0x0001, 0xc410, 0xe510, 0x800d,
+    0xfdb2, 0x0000, 0x6308, 0x8008, 0x4b10, 0x8019, 0xfbe4, 0x0000, 0xa200, 0x8017, 0xfdb2, 0x0001, 0xe510, 0xc408, 0x8004, 0xfdb2,
+    0x0001, 0xe510, 0xfdb2, 0x8003, 0xc510, 0x0003, 0xe510, 0xfdb2, 0xfdb2, 0xe510, 0x8008, 0x4b10, 0x0000, 0xa200, 0x8015, 0xfbe4,
+    0x0004, 0xe400, 0xfbe4, 0xfbe4, 0xa200, 0xe510, 0x8002, 0xfdb2, 0x0000, 0xe510, 0x8012, 0xfdb2, 0x000c, 0xe510, 0xa308, 0xfdb2,
+    0xfdb2, 0xe510, 0xc510, 0xa410, 0xe510, 0x8308, 0xa410, 0xa410, 0x8410, 0x4100, 0x8002, 0x8308, 0x0001, 0xfdb2, 0xe510, 0x8007,
+    0x4b10, 0x0000, 0x8200, 0x8018, 0xfbe4, 0x0001, 0xc308, 0xc308, 0x8002, 0xfdb2, 0x0001, 0xe510, 0xa308, 0x8004, 0xfdb2, 0x0005,
+    0xe510, 0xc510, 0xa410, 0xa410, 0x8308, 0x6208, 0x8004, 0x8308, 0x0002, 0x8310, 0xa410, 0xc510, 0x8002, 0xe510, 0x0002, 0x8308,
+    0xa410, 0xc618, 0x8003, 0xffde, 0x0006, 0x8410, 0x0000, 0x8410, 0xffde, 0xc618, 0x8308, 0x8308, 0x8008, 0x4b10, 0x8011, 0xfbe4,
+    0x0000, 0xe400, 0x8006, 0xfbe4, 0x0000, 0xc308, 0x8002, 0xfdb2, 0x0001, 0xe510, 0xc410, 0x8002, 0xfdb2, 0x8002, 0xa410, 0x0005,
+    0xa514, 0xc618, 0xc618, 0x8308, 0x0000, 0x8310, 0x8003, 0xffde, 0x0005, 0xc6f8, 0xc618, 0xa514, 0x6308, 0x8410, 0xc618, 0x8003,
+    0xffde, 0x0005, 0xc6f8, 0xc6f8, 0xc618, 0x8308, 0x0000, 0x8410, 0x8002, 0xffde, 0x0000, 0x8308, 0x8008, 0x4b10, 0x8019, 0xfbe4,
+    0x0009, 0xa308, 0xe510, 0xfdb2, 0xfdb2, 0xe510, 0xa410, 0xc510, 0xa410, 0xc510, 0xc618, 0x8004, 0xffde, 0x000e, 0x8410, 0x0000,
+    0x8308, 0xc618, 0xa514, 0xc618, 0xc618, 0xc6f8, 0xffde, 0xffde, 0xa514, 0xc618, 0xffde, 0xc6f8, 0xa514, 0x8005, 0xa410, 0x0000,
+    0x8308, 0x8002, 0xa410, 0x0001, 0xa514, 0x6310, 0x8008, 0x4b10, 0x0000, 0xc308, 0x8018, 0xfbe4, 0x0006, 0xc308, 0xe510, 0xfdb2,
+    0xfdb2, 0xe510, 0x6208, 0xa410, 0x8002, 0xffde, 0x0001, 0xc6f8, 0xa510, 0x8003, 0x8308, 0x8004, 0xa410, 0x0009, 0x8308, 0x6208,
+    0x6308, 0xa410, 0xa410, 0xc510, 0xa410, 0x6208, 0xa410, 0xe510, 0x8008, 0xfdb2, 0x0000, 0xa410, 0x8009, 0x4b10, 0x0000, 0xa308,
+    0x8018, 0xfbe4, 0x000c, 0xc308, 0xe510, 0xfdb2, 0xfdb2, 0xe510, 0x8308, 0xffde, 0xc6f8, 0xa510, 0x8410, 0x8410, 0xa410, 0xc510,
+    0x8008, 0xfdb2, 0x0007, 0xe510, 0xfdb2, 0xe510, 0x6208, 0x8308, 0xc510, 0xe510, 0xe510, 0x800b, 0xfdb2, 0x8008, 0x4b10, 0x0000,
+    0x6208, 0x8012, 0xfbe4, 0x0000, 0xe400, 0x8004, 0xfbe4, 0x0009, 0xc308, 0xe408, 0xfdb2, 0xfdb2, 0xe510, 0xa308, 0xa410, 0xa410,
+    0xc510, 0xe510, 0x800e, 0xfdb2, 0x0003, 0xa308, 0xa308, 0xa410, 0xe510, 0x800c, 0xfdb2, 0x8008, 0x4b10, 0x0001, 0x6208, 0xc408,
+    0x8017, 0xfbe4, 0x0008, 0xc308, 0xc308, 0xfdb2, 0xfdb2, 0xe510, 0x8208, 0xc510, 0xfdb2, 0xe510, 0x800e, 0xfdb2, 0x0005, 0xe510,
+    0xa308, 0xfdb2, 0xe510, 0x8208, 0xe510, 0x8008, 0xfdb2, 0x0001, 0xe518, 0xfdb2, 0x800a, 0x4b10, 0x0000, 0x6208, 0x8017, 0xfbe4,
+    0x0001, 0xe308, 0xa308, 0x8002, 0xfdb2, 0x0002, 0xc410, 0xc410, 0xe510, 0x800f, 0xfdb2, 0x0005, 0xe510, 0xc408, 0xfdb2, 0xfdb2,
+    0xe510, 0xa308, 0x8006, 0xfdb2, 0x0003, 0xe510, 0xe510, 0xa514, 0x8308, 0x800a, 0x4b10, 0x0001, 0x6208, 0xa308, 0x800c, 0xfbe4,
+    0x0006, 0xe308, 0xe508, 0xc308, 0xc408, 0xfbe4, 0xfbe4, 0xe308, 0x8003, 0xfbe4, 0x0000, 0xa200, 0x8015, 0xfdb2, 0x0001, 0xa308,
+    0xe510, 0x8002, 0xfdb2, 0x0001, 0xc410, 0xc410, 0x8007, 0xfdb2, 0x0000, 0x6308, 0x800c, 0x4b10, 0x0000, 0x6208, 0x800b, 0xfbe4,
+    0x0002, 0xe308, 0xc308, 0xe510, 0x8002, 0xfdb2, 0x0002, 0xe510, 0xe510, 0xe308, 0x8002, 0xfbe4, 0x0000, 0xa200, 0x8003, 0xfdb2,
+    0x0000, 0xe510, 0x8010, 0xfdb2, 0x0000, 0xe410, 0x8004, 0xfdb2, 0x0001, 0xa308, 0xc410, 0x8004, 0xe510, 0x0002, 0xa410, 0x6308,
+    0x8308, 0x800d, 0x4b10, 0x0000, 0x6100, 0x8006, 0xfbe4, 0x0000, 0xe400, 0x8002, 0xfbe4, 0x0000, 0xa200, 0x8007, 0xfdb2, 0x0003,
+    0xe308, 0xfbe4, 0xfbe4, 0xa200, 0x801c, 0xfdb2, 0x0007, 0xa408, 0x8308, 0x8208, 0x8208, 0x8308, 0x6100, 0x8308, 0x4208, 0x800e,
+    0x4b10, 0x0001, 0x6208, 0x8208, 0x8008, 0xfbe4, 0x0003, 0xc308, 0xe410, 0xfdb2, 0xfdb2, 0x8002, 0xe510, 0x8002, 0xfdb2, 0x0003,
+    0xe510, 0xfbe4, 0xe308, 0xa200, 0x8022, 0xfdb2, 0x0002, 0xe510, 0xa410, 0x6308, 0x800f, 0x4b10, 0x0001, 0x6200, 0xc308, 0x8006,
+    0xfbe4, 0x0007, 0xa308, 0xfdb2, 0xfdb2, 0xc410, 0xa408, 0x8208, 0xa308, 0xc408, 0x8002, 0xfdb2, 0x0002, 0xa308, 0xe408, 0xa208,
+    0x8023, 0xfdb2, 0x0002, 0xe518, 0xe510, 0xa514, 0x8010, 0x4b10, 0x0001, 0x8208, 0xc408, 0x8004, 0xfbe4, 0x000d, 0xc308, 0xfdb2,
+    0xfdb2, 0xa308, 0xc510, 0xe510, 0xfdb2, 0xe510, 0xc408, 0xfdb2, 0xfdb2, 0xe510, 0xa308, 0xa308, 0x8025, 0xfdb2, 0x0001, 0xe510,
+    0x8410, 0x8010, 0x4b10, 0x0002, 0x6208, 0x8200, 0xc308, 0x8002, 0xfbe4, 0x000d, 0xc408, 0xfdb2, 0xfdb2, 0xc510, 0xc410, 0xe510,
+    0xfdb2, 0xfdb2, 0xc410, 0xe510, 0xfdb2, 0xfdb2, 0x8208, 0xe510, 0x8025, 0xfdb2, 0x0002, 0xe510, 0xe510, 0x4208, 0x8011, 0x4b10,
+    0x000c, 0x6208, 0x6208, 0x8208, 0x8200, 0xe410, 0xfdb2, 0xe510, 0xfdb2, 0xc408, 0xe510, 0xfdb2, 0xfdb2, 0xe510, 0x8002, 0xfdb2,
+    0x0001, 0xc408, 0xe510, 0x8025, 0xfdb2, 0x0002, 0xe510, 0xe510, 0x4208, 0x8013, 0x4b10, 0x0001, 0x6208, 0x4108, 0x8003, 0xfdb2,
+    0x0001, 0xc410, 0xe510, 0x802d, 0xfdb2, 0x0001, 0xe510, 0xa410, 0x8016, 0x4b10, 0x0000, 0xa410, 0x8002, 0xfdb2, 0x0001, 0xc510,
+    0xc410, 0x802d, 0xfdb2, 0x0001, 0xe510, 0xe510, 0x8016, 0x4b10, 0x8003, 0xfdb2, 0x0001, 0xe510, 0xa308, 0x8002, 0xe510, 0x8026,
+    0xfdb2, 0x8002, 0xe510, 0x0001, 0xc510, 0x6308, 0x8018, 0x4b10, 0x0000, 0xc410, 0x8003, 0xfdb2, 0x0002, 0xc410, 0xc308, 0xe410,
+    0x8022, 0xfdb2, 0x0007, 0xe510, 0xc410, 0xc410, 0xc408, 0xc408, 0xc308, 0xa408, 0x8308, 0x8019, 0x4b10, 0x0001, 0x6208, 0xc410,
+    0x8003, 0xfdb2, 0x0001, 0xe510, 0xe510, 0x8021, 0xfdb2, 0x0003, 0xe510, 0xc408, 0xc408, 0xc510, 0x8003, 0xe510, 0x801b, 0x4b10,
+    0x0000, 0x6208, 0x802e, 0xfdb2, 0x0001, 0xe510, 0xe510, 0x801b, 0x4b10, 0x0002, 0x4208, 0xa410, 0xe510, 0x802c, 0xfdb2, 0x0002,
+    0xe510, 0xc410, 0x6208, 0x801b, 0x4b10, 0x0002, 0x6208, 0x8308, 0xa308, 0x802b, 0xfdb2, 0x0001, 0xe510, 0x8308, 0x801d, 0x4b10,
+    0x0000, 0x6308, 0x802c, 0xfdb2, 0x0001, 0xe510, 0x4108, 0x801c, 0x4b10, 0x0001, 0x4208, 0xa410, 0x802b, 0xfdb2, 0x0002, 0xe510,
+    0xe510, 0x4208, 0x801c, 0x4b10, 0x0000, 0x6310, 0x802c, 0xfdb2, 0x0001, 0xe510, 0x8308, 0x801d, 0x4b10, 0x802c, 0xfdb2, 0x0002,
+    0xe510, 0xe510, 0x6308, 0x801c, 0x4b10, 0x0000, 0xc510, 0x802c, 0xfdb2, 0x0001, 0xe510, 0xe510, 0x801c, 0x4b10, 0x0000, 0x8310,
+    0x802d, 0xfdb2, 0x0001, 0xe510, 0xe510, 0x801b, 0x4b10, 0x0000, 0x6208, 0x802e, 0xfdb2, 0x0000, 0xe510, 0x801b, 0x4b10, 0x0000,
+    0x4208, 0x802e, 0xfdb2, 0x0000, 0xe510, 0x801b, 0x4b10, 0x0000, 0x4208, 0x802e, 0xfdb2, 0x0000, 0xe510, 0x801b, 0x4b10, 0x0001,
+    0x4208, 0xc510, 0x802c, 0xfdb2, 0x0000, 0xe510, 0x801d, 0x4b10, 0x801b, 0xfdb2, 0x8007, 0xe510, 0x0001, 0xfdb2, 0xfdb2, 0x8006,
+    0xe510, 0x0001, 0xfdb2, 0xc510, 0x801d, 0x4b10, 0x8017, 0xfdb2, 0x0002, 0xe510, 0xc408, 0xa308, 0x8008, 0x8208, 0x0000, 0x4100,
+    0x8004, 0x6208, 0x0003, 0x6308, 0x6208, 0x4208, 0x4208, 0x801e, 0x4b10, 0x8017, 0xfdb2, 0x0002, 0xe510, 0xc410, 0xe510, 0x8007,
+    0xfdb2, 0x0001, 0xe510, 0x8308, 0x8026, 0x4b10, 0x0000, 0x4208, 0x8022, 0xfdb2, 0x8028, 0x4b10, 0x0000, 0x4108, 0x8022, 0xfdb2,
+    0x8027, 0x4b10, 0x0001, 0x6108, 0x4100, 0x8021, 0xfdb2, 0x8026, 0x4b10, 0x0004, 0x6208, 0x6108, 0xa108, 0x8108, 0xc410, 0x8020,
+    0xfdb2, 0x8026, 0x4b10, 0x0000, 0x6108, 0x8002, 0xa108, 0x801f, 0xfdb2, 0x0000, 0xc410, 0x8026, 0x4b10, 0x0000, 0x4108, 0x8002,
+    0xa108, 0x0000, 0x8100, 0x801e, 0xfdb2, 0x0000, 0xa410, 0x8026, 0x4b10, 0x0001, 0x4208, 0x8108, 0x8002, 0xa108, 0x0000, 0x8100,
+    0x801d, 0xfdb2, 0x8028, 0x4b10, 0x0005, 0x6108, 0xa108, 0xc108, 0xa108, 0x8100, 0x8100, 0x801c, 0xfdb2, 0x0000, 0xa410, 0x8027,
+    0x4b10, 0x0006, 0x6108, 0xa108, 0xa108, 0xc108, 0xa108, 0x8100, 0x8100, 0x801b, 0xfdb2, 0x0000, 0xa410, 0x8027, 0x4b10, 0x0007,
+    0x6208, 0x6108, 0xa108, 0xc108, 0xa108, 0xa108, 0x8100, 0x6100, 0x801a, 0xfdb2, 0x0001, 0xc510, 0x6208, 0x8027, 0x4b10, 0x0007,
+    0x6208, 0xa108, 0xa108, 0xc108, 0xc108, 0xa108, 0x8100, 0x6100, 0x801a, 0xfdb2, 0x0001, 0xa308, 0x4108, 0x8027, 0x4b10, 0x0007,
+    0x6108, 0xa108, 0xc108, 0xc108, 0xa108, 0xa108, 0x8108, 0x8108, 0x8019, 0xfdb2, 0x0003, 0xe510, 0x8108, 0x8208, 0x6208, 0x8026,
+    0x4b10, 0x0001, 0x6108, 0xa108, 0x8002, 0xc108, 0x0002, 0xa108, 0xa108, 0xa208, 0x8019, 0xfdb2, 0x0003, 0xc308, 0x8100, 0xa208,
+    0x6108, 0x8025, 0x4b10, 0x0002, 0x4208, 0x8108, 0xa108, 0x8002, 0xc108, 0x0002, 0xa108, 0xa108, 0xa208, 0x8018, 0xfdb2, 0x0005,
+    0xe510, 0x8100, 0xa108, 0xa108, 0x8108, 0x6108, 0x8024, 0x4b10, 0x0001, 0x4108, 0xa108, 0x8003, 0xc108, 0x0002, 0xa108, 0xa108,
+    0x8100, 0x8018, 0xfdb2, 0x0006, 0xc410, 0x8100, 0xa108, 0xc108, 0xa108, 0x8108, 0x6208, 0x8021, 0x4b10, 0x0003, 0x4108, 0x6208,
+    0x6100, 0xa108, 0x8004, 0xc108, 0x0002, 0xa108, 0x8100, 0xe410, 0x8017, 0xfdb2, 0x0006, 0xa208, 0xa108, 0xa108, 0xc108, 0xa108,
+    0xa108, 0x6108, 0x800f, 0x4b10,
+};
+
+UG_BMP fry_rle = {
+  .p=fry_rle_data,
+  .width=77,
+  .height=114,
+  .bpp=BMP_BPP_16,
+  .colors=BMP_RGB565 | BMP_RLE,
+};
+
+
+// Same picture indexed with UGUI/Tools/ugui_bmp_index.c, 52 colors, 8778 bytes
+const uint16_t fry_idx_palette[52] = {
+    0x4b10, 0xa618, 0xc6f8, 0xa514, 0xc618, 0xffff, 0xffde, 0x8510, 0x8410, 0x6310, 0x4208, 0x6308, 0xa518, 0x6410, 0x4308, 0x8310,
+    0xa410, 0x8308, 0x6208, 0x4108, 0x8208, 0x8200, 0xa308, 0xc408, 0xfbe4, 0x6200, 0x4100, 0x6100, 0xa200, 0xc308, 0xa208, 0x8100,
+    0xc200, 0xe400, 0xa300, 0xe308, 0xe410, 0xc410, 0xe510, 0xfdb2, 0xe408, 0xc300, 0xc510, 0xa408, 0x0000, 0xa510, 0xe518, 0xe508,
+    0x6108, 0xa108, 0x8108, 0xc108,
+};
+
+const uint8_t fry_idx_data[8778] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x04, 0x05, 0x06, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x00, 0x03, 0x02, 0x02, 0x04, 0x03, 0x00, 0x00, 0x03,
+    0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x08, 0x00, 0x00, 0x02, 0x02, 0x02,
+    0x04, 0x09, 0x00, 0x00, 0x07, 0x06, 0x05, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x05, 0x08, 0x00, 0x05, 0x02, 0x00, 0x01, 0x05, 0x06, 0x06, 0x05, 0x09, 0x00, 0x00, 0x00,
+    0x06, 0x05, 0x05, 0x05, 0x00, 0x03, 0x05, 0x05, 0x06, 0x05, 0x01, 0x00, 0x04, 0x05, 0x05, 0x06,
+    0x05, 0x08, 0x00, 0x04, 0x05, 0x06, 0x06, 0x05, 0x0b, 0x00, 0x05, 0x05, 0x06, 0x05, 0x06, 0x00,
+    0x0a, 0x06, 0x05, 0x06, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x04,
+    0x00, 0x05, 0x04, 0x00, 0x06, 0x06, 0x08, 0x04, 0x05, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x02,
+    0x07, 0x00, 0x04, 0x05, 0x06, 0x03, 0x05, 0x02, 0x00, 0x04, 0x05, 0x02, 0x04, 0x05, 0x04, 0x00,
+    0x06, 0x06, 0x08, 0x02, 0x05, 0x03, 0x00, 0x05, 0x06, 0x03, 0x06, 0x06, 0x00, 0x0d, 0x06, 0x06,
+    0x03, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x02, 0x00, 0x05, 0x04,
+    0x00, 0x06, 0x05, 0x09, 0x0c, 0x05, 0x04, 0x00, 0x00, 0x00, 0x02, 0x05, 0x03, 0x00, 0x00, 0x04,
+    0x05, 0x02, 0x0b, 0x05, 0x06, 0x00, 0x04, 0x05, 0x04, 0x08, 0x06, 0x02, 0x00, 0x06, 0x06, 0x09,
+    0x02, 0x05, 0x04, 0x00, 0x05, 0x05, 0x0b, 0x04, 0x05, 0x00, 0x08, 0x05, 0x06, 0x09, 0x06, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x06, 0x00, 0x05, 0x02, 0x00, 0x06, 0x05,
+    0x09, 0x03, 0x05, 0x04, 0x00, 0x00, 0x00, 0x02, 0x05, 0x04, 0x00, 0x00, 0x04, 0x06, 0x04, 0x09,
+    0x05, 0x06, 0x00, 0x04, 0x05, 0x04, 0x03, 0x05, 0x02, 0x00, 0x06, 0x05, 0x09, 0x04, 0x05, 0x04,
+    0x00, 0x05, 0x05, 0x09, 0x04, 0x05, 0x00, 0x0d, 0x06, 0x06, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x06, 0x06, 0x06, 0x04, 0x00, 0x06, 0x06, 0x0b, 0x04, 0x06,
+    0x04, 0x00, 0x00, 0x00, 0x02, 0x05, 0x06, 0x06, 0x00, 0x04, 0x06, 0x06, 0x02, 0x06, 0x03, 0x00,
+    0x04, 0x05, 0x06, 0x06, 0x06, 0x08, 0x00, 0x06, 0x06, 0x0b, 0x02, 0x05, 0x04, 0x00, 0x05, 0x06,
+    0x02, 0x06, 0x02, 0x00, 0x00, 0x06, 0x06, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x06, 0x06, 0x05, 0x06, 0x04, 0x00, 0x06, 0x05, 0x0b, 0x03, 0x06, 0x04, 0x00, 0x00,
+    0x00, 0x02, 0x05, 0x06, 0x06, 0x00, 0x03, 0x05, 0x06, 0x06, 0x06, 0x08, 0x00, 0x04, 0x06, 0x06,
+    0x06, 0x06, 0x0b, 0x00, 0x06, 0x06, 0x0b, 0x02, 0x05, 0x04, 0x00, 0x05, 0x05, 0x06, 0x05, 0x04,
+    0x00, 0x00, 0x09, 0x06, 0x06, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05,
+    0x02, 0x05, 0x05, 0x04, 0x00, 0x06, 0x06, 0x0b, 0x03, 0x06, 0x04, 0x00, 0x00, 0x00, 0x02, 0x05,
+    0x04, 0x0a, 0x00, 0x04, 0x06, 0x02, 0x08, 0x06, 0x02, 0x00, 0x04, 0x06, 0x02, 0x03, 0x05, 0x04,
+    0x00, 0x06, 0x06, 0x0b, 0x02, 0x05, 0x04, 0x00, 0x05, 0x05, 0x08, 0x02, 0x05, 0x00, 0x00, 0x00,
+    0x0a, 0x02, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x06, 0x06,
+    0x02, 0x00, 0x06, 0x05, 0x09, 0x03, 0x05, 0x04, 0x00, 0x00, 0x00, 0x02, 0x05, 0x03, 0x00, 0x00,
+    0x03, 0x05, 0x02, 0x0a, 0x05, 0x06, 0x00, 0x04, 0x05, 0x04, 0x08, 0x05, 0x02, 0x00, 0x06, 0x05,
+    0x0b, 0x02, 0x05, 0x04, 0x00, 0x05, 0x05, 0x0b, 0x04, 0x05, 0x00, 0x0b, 0x06, 0x02, 0x08, 0x05,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x06, 0x06, 0x02, 0x00, 0x06,
+    0x06, 0x09, 0x03, 0x06, 0x04, 0x00, 0x00, 0x00, 0x02, 0x05, 0x04, 0x00, 0x00, 0x01, 0x06, 0x02,
+    0x0b, 0x05, 0x06, 0x00, 0x04, 0x05, 0x04, 0x08, 0x05, 0x02, 0x00, 0x06, 0x06, 0x09, 0x02, 0x05,
+    0x04, 0x00, 0x05, 0x05, 0x0b, 0x04, 0x05, 0x00, 0x09, 0x06, 0x06, 0x0b, 0x06, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x06, 0x06, 0x04, 0x00, 0x06, 0x05, 0x03, 0x02,
+    0x05, 0x03, 0x00, 0x00, 0x00, 0x02, 0x05, 0x06, 0x02, 0x00, 0x04, 0x05, 0x02, 0x0b, 0x05, 0x02,
+    0x00, 0x04, 0x05, 0x04, 0x08, 0x06, 0x02, 0x00, 0x02, 0x05, 0x04, 0x06, 0x05, 0x03, 0x00, 0x05,
+    0x05, 0x0b, 0x04, 0x06, 0x00, 0x0a, 0x05, 0x06, 0x04, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x05, 0x00, 0x04, 0x06, 0x04, 0x00, 0x07, 0x06, 0x05, 0x05, 0x06, 0x0b, 0x00,
+    0x00, 0x00, 0x02, 0x05, 0x06, 0x06, 0x00, 0x04, 0x05, 0x02, 0x0b, 0x05, 0x02, 0x00, 0x04, 0x06,
+    0x04, 0x08, 0x06, 0x02, 0x00, 0x03, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x06, 0x06, 0x0b, 0x04,
+    0x06, 0x00, 0x00, 0x02, 0x05, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0x08, 0x00, 0x00, 0x08, 0x09, 0x00, 0x00, 0x0d, 0x03, 0x03, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0d,
+    0x08, 0x08, 0x08, 0x00, 0x09, 0x08, 0x0d, 0x00, 0x08, 0x08, 0x00, 0x0f, 0x10, 0x11, 0x12, 0x10,
+    0x0f, 0x00, 0x00, 0x08, 0x03, 0x03, 0x12, 0x00, 0x00, 0x10, 0x10, 0x13, 0x11, 0x08, 0x00, 0x00,
+    0x0a, 0x03, 0x03, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x15, 0x16, 0x16, 0x15, 0x14, 0x12, 0x13, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x14, 0x16, 0x16, 0x16, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x17, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x17, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x17, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x16, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x14, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x16, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x19, 0x19, 0x12, 0x12, 0x12, 0x12, 0x12, 0x19, 0x19,
+    0x1a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x16, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x19, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1a, 0x1a, 0x16, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x16, 0x14,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x16, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x16, 0x0a, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x1b, 0x1c, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x16, 0x11,
+    0x12, 0x0b, 0x12, 0x1b, 0x16, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x12,
+    0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x1d, 0x16,
+    0x15, 0x1d, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x12, 0x19, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x17, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x1f, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1a, 0x1d, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x20, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x16, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x16, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x12, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x16, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x18,
+    0x18, 0x18, 0x21, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x16, 0x18, 0x1d, 0x12, 0x1a, 0x00, 0x00, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+    0x18, 0x18, 0x18, 0x18, 0x16, 0x1a, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x1d, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x16, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x16, 0x18, 0x18, 0x21, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x12, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x20, 0x1c,
+    0x22, 0x1d, 0x1d, 0x1d, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x21, 0x18, 0x18, 0x18, 0x18, 0x18, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x16, 0x16, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x23, 0x17, 0x24, 0x25, 0x17, 0x17,
+    0x1d, 0x1d, 0x16, 0x16, 0x1d, 0x1d, 0x1d, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+    0x17, 0x18, 0x18, 0x18, 0x21, 0x21, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1c, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26,
+    0x26, 0x24, 0x17, 0x1d, 0x16, 0x1c, 0x20, 0x1d, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1c, 0x27, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x26, 0x28, 0x16, 0x15, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x16, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x18, 0x1d, 0x1e, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x17, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x1d, 0x16, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x26, 0x18, 0x18, 0x18, 0x29, 0x29, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x12, 0x1b, 0x14, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d,
+    0x17, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x26, 0x26, 0x26, 0x26, 0x16, 0x1c, 0x22, 0x1d, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1b, 0x15, 0x1d, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1c, 0x26, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x17, 0x16, 0x1c, 0x1c, 0x29, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x12, 0x19, 0x1d, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x1f, 0x1d, 0x1d, 0x1d, 0x23, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x17, 0x1d, 0x1d, 0x1e, 0x15, 0x19, 0x12, 0x12, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+    0x15, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d,
+    0x1d, 0x26, 0x28, 0x1d, 0x1c, 0x18, 0x18, 0x18, 0x16, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x1b, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x22, 0x26, 0x27,
+    0x27, 0x26, 0x1d, 0x1c, 0x1d, 0x16, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x17, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1c, 0x26, 0x27, 0x27, 0x27,
+    0x26, 0x16, 0x14, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x26, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x16, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26,
+    0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2b, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x15, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x1d, 0x1d, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1e,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x1d, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x26, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x15, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x26, 0x25, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x24, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26,
+    0x17, 0x25, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x16, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x16, 0x26,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x0f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x1d, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x16, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d,
+    0x17, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1c, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x17, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x27, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x26, 0x27, 0x27, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x21, 0x18, 0x18, 0x1c, 0x26, 0x27, 0x27, 0x27, 0x26,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x26, 0x16, 0x27, 0x27, 0x26, 0x2a, 0x10, 0x26, 0x11, 0x10, 0x10, 0x08, 0x1a,
+    0x11, 0x11, 0x11, 0x27, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x1d, 0x27, 0x27, 0x27, 0x26, 0x16, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x26, 0x2a, 0x10, 0x10, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0f, 0x10,
+    0x2a, 0x26, 0x26, 0x26, 0x11, 0x10, 0x04, 0x06, 0x06, 0x06, 0x06, 0x08, 0x2c, 0x08, 0x06, 0x04,
+    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x21, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x27, 0x27, 0x27, 0x26, 0x25, 0x27, 0x27, 0x27, 0x10, 0x10,
+    0x10, 0x03, 0x04, 0x04, 0x11, 0x2c, 0x0f, 0x06, 0x06, 0x06, 0x06, 0x02, 0x04, 0x03, 0x0b, 0x08,
+    0x04, 0x06, 0x06, 0x06, 0x06, 0x02, 0x02, 0x04, 0x11, 0x2c, 0x08, 0x06, 0x06, 0x06, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x16, 0x26, 0x27, 0x27, 0x26, 0x10, 0x2a, 0x10, 0x2a, 0x04, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x08, 0x2c, 0x11, 0x04, 0x03, 0x04, 0x04, 0x02, 0x06, 0x06, 0x03, 0x04, 0x06, 0x02, 0x03,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x10, 0x10, 0x10, 0x03, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d,
+    0x26, 0x27, 0x27, 0x26, 0x12, 0x10, 0x06, 0x06, 0x06, 0x02, 0x2d, 0x11, 0x11, 0x11, 0x11, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x11, 0x12, 0x0b, 0x10, 0x10, 0x2a, 0x10, 0x12, 0x10, 0x26, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x26, 0x27, 0x27,
+    0x26, 0x11, 0x06, 0x02, 0x2d, 0x08, 0x08, 0x10, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x26, 0x27, 0x26, 0x12, 0x11, 0x2a, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x21, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x28, 0x27, 0x27, 0x26, 0x16, 0x10,
+    0x10, 0x2a, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x16, 0x16, 0x10, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x17, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x1d, 0x27, 0x27, 0x26, 0x14, 0x2a, 0x27, 0x26, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x16,
+    0x27, 0x26, 0x14, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2e, 0x27, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x23, 0x16, 0x27, 0x27, 0x27, 0x25, 0x25, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x17, 0x27, 0x27, 0x26,
+    0x16, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x03, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x16, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x23, 0x2f, 0x1d, 0x17, 0x18, 0x18, 0x23, 0x18, 0x18, 0x18,
+    0x18, 0x1c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x16, 0x26, 0x27, 0x27, 0x27, 0x25, 0x25, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x23, 0x1d, 0x26, 0x27, 0x27, 0x27, 0x26, 0x26, 0x23, 0x18, 0x18, 0x18, 0x1c, 0x27,
+    0x27, 0x27, 0x27, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x24, 0x27, 0x27, 0x27, 0x27, 0x27, 0x16, 0x25, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x10, 0x0b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x21, 0x18, 0x18, 0x18, 0x1c,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x23, 0x18, 0x18, 0x1c, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2b, 0x11, 0x14, 0x14, 0x11, 0x1b, 0x11,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x14, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x24, 0x27, 0x27, 0x26,
+    0x26, 0x26, 0x27, 0x27, 0x27, 0x26, 0x18, 0x23, 0x1c, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x10, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+    0x1d, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x16, 0x27, 0x27, 0x25, 0x2b, 0x14, 0x16, 0x17,
+    0x27, 0x27, 0x27, 0x16, 0x28, 0x1e, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2e, 0x26, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x17,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x1d, 0x27, 0x27, 0x16, 0x2a, 0x26, 0x27, 0x26, 0x17, 0x27, 0x27,
+    0x26, 0x16, 0x16, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x15, 0x1d, 0x18,
+    0x18, 0x18, 0x17, 0x27, 0x27, 0x2a, 0x25, 0x26, 0x27, 0x27, 0x25, 0x26, 0x27, 0x27, 0x14, 0x26,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x14, 0x15, 0x24,
+    0x27, 0x26, 0x27, 0x17, 0x26, 0x27, 0x27, 0x26, 0x27, 0x27, 0x27, 0x17, 0x26, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x26, 0x26, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x13, 0x27, 0x27, 0x27, 0x27,
+    0x25, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x26, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x27, 0x27, 0x27, 0x2a, 0x25, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x27, 0x27, 0x27, 0x26, 0x16, 0x26, 0x26, 0x26, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x26, 0x2a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x25, 0x27, 0x27, 0x27, 0x27, 0x25, 0x1d, 0x24, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26,
+    0x25, 0x25, 0x17, 0x17, 0x1d, 0x2b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x12, 0x25, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x17, 0x17, 0x2a, 0x26,
+    0x26, 0x26, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26,
+    0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x10, 0x26,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x25, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x11, 0x16, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x10, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x26, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x26, 0x26, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26,
+    0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x2a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x2a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x17, 0x16, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x1a, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0b, 0x12, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x26, 0x25, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x1a, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x30, 0x31, 0x32, 0x25, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x31, 0x31, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x13, 0x31, 0x31, 0x31, 0x1f, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x32, 0x31, 0x31, 0x31, 0x1f, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x33, 0x31,
+    0x1f, 0x1f, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x31, 0x33, 0x31, 0x1f, 0x1f, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x30, 0x31, 0x33, 0x31, 0x31, 0x1f, 0x1b, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2a, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x12, 0x31, 0x31, 0x33, 0x33, 0x31, 0x1f, 0x1b, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x16, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31,
+    0x33, 0x33, 0x31, 0x31, 0x32, 0x32, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x26, 0x32, 0x14, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x33, 0x33, 0x33,
+    0x31, 0x31, 0x1e, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x1d, 0x1f, 0x1e,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x32, 0x31, 0x33, 0x33, 0x33, 0x31, 0x31, 0x1e,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x26, 0x1f, 0x31, 0x31, 0x32, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x31, 0x33, 0x33, 0x33, 0x33, 0x31, 0x31, 0x1f, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x25, 0x1f, 0x31, 0x33, 0x31, 0x32, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+    0x12, 0x1b, 0x31, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x1f, 0x24, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0x1e, 0x31, 0x31, 0x33, 0x31, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+UG_BMP fry_idx = {
+  .p=fry_idx_data,
+  .width=77,
+  .height=114,
+  .bpp=BMP_BPP_8,
+  .colors=BMP_RGB565,
+  .palette=fry_idx_palette,
+};
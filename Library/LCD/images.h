@@ -4,5 +4,7 @@
 #include "ugui.h"
 
 extern UG_BMP fry;
+extern UG_BMP fry_rle;
+extern UG_BMP fry_idx;
 
 #endif
@@ -1,4 +1,5 @@
 #include "lcd.h"
+#include <string.h>
 
 
 /* Arg count, CMD, Args if any */
@@ -52,20 +53,109 @@ const uint8_t init_cmd[] = {
 
 
 static void LCD_Update(void);
+#ifdef LCD_LOCAL_FB
+static void LCD_PsetFB(int16_t x, int16_t y, uint16_t color);
+#elif !defined LCD_BAND_FB
+static void LCD_Pset(int16_t x, int16_t y, uint16_t color);
+#endif
 typedef struct{
-  int8_t spi_sz;
-  int8_t dma_sz;
-  int8_t dma_mem_inc;
+  int16_t win_x0, win_x1;       // Column and row window last sent to the controller
+  int16_t win_y0, win_y1;
+  uint32_t cmd_skipped;         // CASET/RASET commands not sent because the window didn't change
+  uint8_t madctl;               // Memory access control last sent
 }config_t;
 
 config_t config = {
-    .spi_sz = -1,
-    .dma_sz = -1,
-    .dma_mem_inc = -1,
+    .win_x0 = -1,
+    .win_y0 = -1,
+    .madctl = LCD_ROTATION_CMD,
 };
 
+static struct{
+  uint16_t tfa, vsa, vsp;       // Hardware scroll area and start address in controller rows, vsa 0 if not scrolling
+  uint8_t area_changed;         // VSCRDEF must be sent again
+#if defined LCD_LOCAL_FB || defined LCD_BAND_FB
+  uint8_t pending;              // Sent by LCD_Update, once the exposed rows are in the controller
+#endif
+}scroll;
+
 #ifdef LCD_LOCAL_FB
+#if LCD_FB_BPP==16
 static uint16_t fb[LCD_WIDTH*LCD_HEIGHT];
+#ifdef LCD_ASYNC_DMA
+static uint32_t fb_ticket;                                          // Queue position after the last update, the DMA reads the framebuffer until then
+#endif
+#else
+#define LCD_FB_COLORS     (1<<LCD_FB_BPP)
+static uint8_t fb[((uint32_t)LCD_WIDTH*LCD_HEIGHT*LCD_FB_BPP+7)/8];   // Palette indexes, 4bpp packs the even pixel in the low nibble
+static uint16_t fb_palette[LCD_FB_COLORS] = { C_BLACK };           // Framebuffer starts cleared to index 0
+static uint16_t fb_colors = 1;                                      // Palette slots in use
+static uint16_t fb_line[2][LCD_WIDTH*LCD_FB_LINES];                 // Ping-pong buffers, a band of rows is expanded while the other is sent
+#ifdef LCD_ASYNC_DMA
+static uint32_t fb_line_ticket[2];                                  // Queue position after the last transfer using each line buffer
+#endif
+#endif
+
+typedef struct{
+  int16_t x0, y0, x1, y1;
+}rect_t;
+
+static rect_t dirty[LCD_FB_DIRTY_RECTS];               // Framebuffer areas changed since the last update
+static uint8_t dirty_cnt;
+#endif
+
+#ifdef LCD_BAND_FB
+/* Display list entries, one tag word followed by the arguments */
+#define DL_RECT           1              // x0, y0, x1, y1, color
+#define DL_PIXEL          2              // x, y, color
+#define DL_AREA           3              // x0, y0, x1, y1, start x. Followed by the DL_RUN entries pushed into it
+#define DL_RUN            4              // count, color
+#define DL_BMP            5              // x, y, width, height, source stride, pixel pointer
+#define DL_PTR_WORDS      ((sizeof(void*)+1)/2)
+
+static void LCD_DrawPixelBand(int16_t x, int16_t y, uint16_t color);
+static void LCD_BandRender(void);
+
+static uint16_t dl[LCD_BAND_DL_SIZE];                   // Draw calls recorded since the last update
+static uint16_t dl_len;
+static struct{
+  int16_t x0, y0, x1, y1;
+  uint32_t pushed;                                      // Pixels pushed so far, to reopen the area if the list fills up
+  uint8_t open;
+}dl_area;
+static uint16_t band[2][LCD_WIDTH*LCD_BAND_LINES];      // Ping-pong band buffers, one renders while the other is sent
+static uint8_t band_cover[(LCD_WIDTH*LCD_BAND_LINES+7)/8];  // Pixels of the band drawn in this frame
+#ifdef LCD_ASYNC_DMA
+static uint32_t band_ticket[2];                         // Queue position after the last transfer using each band buffer
+#endif
+#endif
+
+#define LCD_WIN_BYTES     11             // CASET, RASET and RAMWR with their arguments
+
+#ifdef LCD_ASYNC_DMA
+#define LCD_QUEUE_LEN     8              // Queued transfers, must be a power of 2
+
+typedef struct{
+  int16_t x0, y0, x1, y1;                // Address window
+  const uint16_t *src;                   // Pixel data, NULL for fills
+  uint32_t count;                        // Pixels left to send
+  uint16_t stride;                       // Source row pitch in pixels, sent one row at a time. 0 if the data is contiguous
+  uint16_t color;                        // Fill color
+  uint8_t win[LCD_WIN_BYTES];            // Address window commands, encoded when queued
+  uint8_t segs;                          // Window segments still to send, see LCD_EncodeWindow()
+  uint8_t started;                       // Controller selected
+}xfer_t;
+
+static struct{
+  xfer_t entry[LCD_QUEUE_LEN];
+  volatile uint32_t head;                // Transfers queued so far, only written by the application
+  volatile uint32_t tail;                // Transfers completed so far, only written by the transfer complete interrupt
+  volatile uint8_t active;               // Queue is being drained
+  void (*callback)(void);                // Called from the interrupt when the queue runs empty
+}queue;
+
+static uint16_t img_line[2][LCD_WIDTH];  // Ping-pong row buffers for BMP_RLE and indexed images, one is decoded while the other is sent
+static uint32_t img_ticket[2];           // Queue position after the last transfer using each row buffer
 #endif
 
 static UG_GUI gui;
@@ -73,314 +163,1284 @@ static UG_DEVICE device = {
     .x_dim = LCD_WIDTH,
     .y_dim = LCD_HEIGHT,
 #ifdef LCD_LOCAL_FB
-    .pset = LCD_DrawPixelFB,
+    .pset = LCD_PsetFB,
+#elif defined LCD_BAND_FB
+    .pset = LCD_DrawPixelBand,
 #else
-    .pset = LCD_DrawPixel,
+    .pset = LCD_Pset,
 #endif
     .flush = LCD_Update,
 };
 
-#define mode_16bit    1
-#define mode_8bit     0
-/*
- * @brief Sets SPI interface word size (0=8bit, 1=16 bit)
+#define ASYNC_Min_Pixels  32             // Smaller fills are sent right away, queueing them costs more than the transfer
+
+static const lcd_transport_t *bus = &LCD_TRANSPORT;
+volatile uint32_t lcd_bus_bytes;
+
+static struct{
+  uint16_t buf[LCD_SINK_SIZE];           // Pixels pushed through DRIVER_FILL_AREA, not sent yet
+  uint16_t len;
+}sink;
+
+/**
+ * @brief Sends the pixels waiting in the fill area sink
  * @param none
  * @return none
  */
+static void LCD_SinkFlush(void)
+{
+  uint16_t len = sink.len;
+  if(!len){
+    return;
+  }
+  sink.len = 0;
+#ifdef LCD_ASYNC_DMA
+  while(queue.active) LCD_IDLE();
+#endif
+  bus->begin();
+  bus->write(sink.buf, len);
+  bus->end();
+}
+
+/**
+ * @brief Waits until queued DMA transfers are done and the sink is empty, so the bus can be used directly
+ * @param none
+ * @return none
+ */
+static void LCD_WaitBus(void)
+{
+  LCD_SinkFlush();
+#ifdef LCD_ASYNC_DMA
+  while(queue.active) LCD_IDLE();
+#endif
+}
+
+/**
+ * @brief Write command to ST7735 controller
+ * @param cmd -> command to write, followed by the arguments
+ * @param argc -> argument count
+ * @return none
+ */
+static void LCD_WriteCommand(uint8_t *cmd, uint8_t argc)
+{
+  LCD_WaitBus();
+  bus->begin();
+  bus->command(cmd[0], cmd+1, argc);
+  bus->end();
+}
+
+/**
+ * @brief Write pixel data to ST7735 controller
+ * @param pixels -> pixel data
+ * @param count -> pixel count
+ * @return none
+ */
+static void LCD_WriteData(const uint16_t *pixels, uint32_t count)
+{
+  LCD_WaitBus();
+  bus->begin();
+  bus->write(pixels, count);
+  bus->end();
+}
+
+/**
+ * @brief Selects the bus used to talk to the controller. LCD_TRANSPORT is used by default
+ * @param transport -> bus implementation
+ * @return none
+ */
+void LCD_SetTransport(const lcd_transport_t *transport)
+{
+  LCD_WaitBus();
+  bus = transport;
+  config.win_x0 = -1;                   // Unknown window on the new bus
+  config.win_y0 = -1;
+}
+
+/**
+ * @brief Set the rotation direction of the display
+ * @param m -> rotation parameter(please refer it in ST7735.h)
+ * @return none
+ */
+void LCD_SetRotation(uint8_t m)
+{
+  uint8_t cmd[] = { CMD_MADCTL, 0};
+
+  m = m % 4; // can't be higher than 3
+
+  switch (m)
+  {
+  case 0:
+#if LCD_IS_160X80
+    cmd[1] = CMD_MADCTL_MX | CMD_MADCTL_MY | CMD_MADCTL_BGR;
+#else
+    cmd[1] = CMD_MADCTL_MX | CMD_MADCTL_MY | CMD_MADCTL_RGB;
+#endif
+    break;
+  case 1:
+#if CMD_IS_160X80
+    cmd[1] = CMD_MADCTL_MY | CMD_MADCTL_MV | CMD_MADCTL_BGR;
+#else
+    cmd[1] = CMD_MADCTL_MY | CMD_MADCTL_MV | CMD_MADCTL_RGB;
+#endif
+    break;
+  case 2:
+#if CMD_IS_160X80
+    cmd[1] = CMD_MADCTL_BGR;
+#else
+    cmd[1] = CMD_MADCTL_RGB;
+#endif
+    break;
+  case 3:
+#if CMD_IS_160X80
+    cmd[1] = CMD_MADCTL_MX | CMD_MADCTL_MV | CMD_MADCTL_BGR;
+#else
+    cmd[1] = CMD_MADCTL_MX | CMD_MADCTL_MV | CMD_MADCTL_RGB;
+#endif
+    break;
+  }
+  config.madctl = cmd[1];
+  LCD_WriteCommand(cmd, sizeof(cmd)-1);
+}
+
 
-static void setSPI_Size(int8_t size){
-  if(config.spi_sz!=size){
-    __HAL_SPI_DISABLE(&LCD_HANDLE);
-    config.spi_sz=size;
-    if(size==mode_16bit){
-      LCD_HANDLE.Init.DataSize = SPI_DATASIZE_16BIT;
-      LCD_HANDLE.Instance->CR1 |= SPI_CR1_DFF;
+/**
+ * @brief Encode the address window commands and update the window cache. CASET/RASET are left out if they didn't change
+ * @param xi&yi -> coordinates of window
+ * @param win -> LCD_WIN_BYTES bytes: CASET and its 4 arguments, RASET and its 4 arguments, RAMWR
+ * @return segments to send, bit k for segment k. Even segments are a command byte, odd ones its 4 arguments
+ */
+static uint8_t LCD_EncodeWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t *win)
+{
+  int16_t x_start = x0 + LCD_X_SHIFT, x_end = x1 + LCD_X_SHIFT;
+  int16_t y_start = y0 + LCD_Y_SHIFT, y_end = y1 + LCD_Y_SHIFT;
+  uint8_t segs = 1<<4;                  // RAMWR is always sent
+
+  /* Column Address set */
+  if(config.win_x0!=x_start || config.win_x1!=x_end){
+    win[0] = CMD_CASET;
+    win[1] = x_start >> 8;
+    win[2] = x_start & 0xFF;
+    win[3] = x_end >> 8;
+    win[4] = x_end & 0xFF;
+    segs |= 3<<0;
+    config.win_x0 = x_start;
+    config.win_x1 = x_end;
+  }
+  else{
+    config.cmd_skipped++;
+  }
+  /* Row Address set */
+  if(config.win_y0!=y_start || config.win_y1!=y_end){
+    win[5] = CMD_RASET;
+    win[6] = y_start >> 8;
+    win[7] = y_start & 0xFF;
+    win[8] = y_end >> 8;
+    win[9] = y_end & 0xFF;
+    segs |= 3<<2;
+    config.win_y0 = y_start;
+    config.win_y1 = y_end;
+  }
+  else{
+    config.cmd_skipped++;
+  }
+  /* Write to RAM */
+  win[10] = CMD_RAMWR;
+  return segs;
+}
+
+/**
+ * @brief Send the address window commands, CS must be already asserted. CASET/RASET are skipped if they didn't change
+ * @param xi&yi -> coordinates of window
+ * @return none
+ */
+static void LCD_SendWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  uint8_t win[LCD_WIN_BYTES];
+  uint8_t segs = LCD_EncodeWindow(x0, y0, x1, y1, win);
+
+  for(uint8_t k=0; k<5; k+=2){
+    if(segs & (1<<k)){
+      bus->command(win[k/2*5], &win[k/2*5+1], k<4 ? 4 : 0);
+    }
+  }
+}
+
+/**
+ * @brief Set address of DisplayWindow, all commands are sent in a single CS cycle
+ * @param xi&yi -> coordinates of window
+ * @return none
+ */
+static void LCD_SetAddressWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  LCD_WaitBus();
+  bus->begin();
+  LCD_SendWindow(x0, y0, x1, y1);
+  bus->end();
+}
+
+/**
+ * @brief Forget the cached address window, so the next one is always sent. Needed after a reset or raw CASET/RASET commands.
+ * @param none
+ * @return none
+ */
+static void LCD_InvalidateWindow(void)
+{
+  LCD_WaitBus();
+  config.win_x0 = -1;
+  config.win_y0 = -1;
+}
+
+/**
+ * @brief Returns the number of CASET/RASET commands skipped by the address window cache
+ * @param none
+ * @return skipped commands
+ */
+uint32_t LCD_GetSkippedCommands(void)
+{
+  return config.cmd_skipped;
+}
+
+/**
+ * @brief Returns the bytes sent to the controller so far, commands, arguments and pixels. Wraps around at 4GB
+ * @param none
+ * @return byte count
+ */
+uint32_t LCD_GetBusBytes(void)
+{
+  return lcd_bus_bytes;
+}
+
+#ifdef LCD_ASYNC_DMA
+/**
+ * @brief Sends the next address window segment or pixel chunk of the transfer at the queue tail.
+ *        Called by the application when the queue was idle, then from the transfer complete interrupt.
+ *        Only starts DMA, the window was encoded by LCD_Enqueue() so no polled command runs in the interrupt.
+ * @param none
+ * @return none
+ */
+static void LCD_StartTransfer(void)
+{
+  xfer_t *x = &queue.entry[queue.tail & (LCD_QUEUE_LEN-1)];
+  uint16_t chunk = x->count > 65535 ? 65535 : x->count;                                             // HAL can't send more than 64K at once
+  const uint16_t *src = x->src;
+
+  if(!x->started){
+    x->started = 1;
+    bus->begin();
+  }
+  if(x->segs){                                                                                      // Address window first, one segment per interrupt
+    uint8_t k = 0;
+    while(!(x->segs & (1<<k))){
+      k++;
+    }
+    x->segs &= ~(1<<k);
+    bus->start_bytes(&x->win[k/2*5 + (k&1)], (k&1) ? 4 : 1, k&1);
+    return;
+  }
+  if(x->stride){
+    chunk = x->x1-x->x0+1;                                                                          // Strided source, one row per chunk
+  }
+  if(src){
+    x->src += x->stride ? x->stride : chunk;
+  }
+  else{
+    src = &x->color;
+  }
+  x->count -= chunk;                                                                                // Update before starting, the interrupt might come back at once
+  bus->start(src, chunk, src==&x->color);
+}
+
+/**
+ * @brief Adds a transfer to the queue and starts it if the bus is idle. Waits only if the queue is full.
+ * @param x0&y0&x1&y1 -> address window
+ * @param src -> pixel data, must stay valid until the transfer is done. NULL for fixed color transfers
+ * @param count -> pixels to send
+ * @param color -> fill color, used when src is NULL
+ * @param stride -> source row pitch in pixels if the rows aren't contiguous, else 0
+ * @return none
+ */
+static void LCD_Enqueue(int16_t x0, int16_t y0, int16_t x1, int16_t y1, const uint16_t *src, uint32_t count, uint16_t color, uint16_t stride)
+{
+  xfer_t *x;
+  uint8_t start;
+
+  LCD_SinkFlush();                                                                                  // Pixels pushed before go first, it can't be flushed from the interrupt
+  if(!bus->start){                                                                                  // Bus can't work in the background, send it now
+    LCD_SetAddressWindow(x0, y0, x1, y1);
+    LCD_WaitBus();
+    bus->begin();
+    if(!src){
+      bus->fill(color, count);
+    }
+    else if(!stride){
+      bus->write(src, count);
     }
     else{
-      LCD_HANDLE.Init.DataSize = SPI_DATASIZE_8BIT;
-      LCD_HANDLE.Instance->CR1 &= ~(SPI_CR1_DFF);
+      for(uint16_t w=x1-x0+1; count; count-=w, src+=stride){
+        bus->write(src, w);
+      }
+    }
+    bus->end();
+    return;
+  }
+
+  while(queue.head-queue.tail >= LCD_QUEUE_LEN) LCD_IDLE();                                          // Queue full
+  x = &queue.entry[queue.head & (LCD_QUEUE_LEN-1)];
+  x->x0 = x0;
+  x->y0 = y0;
+  x->x1 = x1;
+  x->y1 = y1;
+  x->src = src;
+  x->count = count;
+  x->stride = stride;
+  x->color = color;
+  x->segs = LCD_EncodeWindow(x0, y0, x1, y1, x->win);                                              // Here and not in the interrupt, which only starts DMA
+  x->started = 0;
+
+  __disable_irq();
+  queue.head++;
+  start = !queue.active;
+  queue.active = 1;
+  __enable_irq();
+  if(start){
+    LCD_StartTransfer();
+  }
+}
+
+/**
+ * @brief Transfer complete, called by the bus from its interrupt. Chains the next chunk or queued transfer.
+ * @param none
+ * @return none
+ */
+void LCD_TransferDone(void)
+{
+  if(!queue.active){
+    return;
+  }
+  xfer_t *x = &queue.entry[queue.tail & (LCD_QUEUE_LEN-1)];
+  if(x->segs || x->count){                                                                          // Transfer not done yet, send next segment or chunk
+    LCD_StartTransfer();
+    return;
+  }
+  bus->end();
+  queue.tail++;
+  if(queue.tail!=queue.head){
+    LCD_StartTransfer();
+  }
+  else{
+    queue.active = 0;
+    if(queue.callback){
+      queue.callback();
+    }
+  }
+}
+
+/**
+ * @brief Sets a function to be called from the interrupt when all queued transfers are done
+ * @param cb -> callback, NULL to disable
+ * @return none
+ */
+void LCD_SetTransferCallback(void (*cb)(void))
+{
+  queue.callback = cb;
+}
+
+/**
+ * @brief Returns 1 while queued transfers are in progress
+ * @param none
+ * @return busy status
+ */
+uint8_t LCD_QueueBusy(void)
+{
+  return queue.active;
+}
+#endif
+
+/**
+ * @brief Waits until all queued transfers are done.
+ *        Call before modifying any buffer handed to the driver. Does nothing without LCD_ASYNC_DMA.
+ * @param none
+ * @return none
+ */
+void LCD_FlushQueue(void)
+{
+#ifdef LCD_ASYNC_DMA
+  while(queue.active) LCD_IDLE();
+#endif
+}
+
+
+/**
+ * @brief Address and draw a Pixel
+ * @param x&y -> coordinate to Draw
+ * @param color -> color of the Pixel
+ * @return none
+ */
+void LCD_DrawPixel(int16_t x, int16_t y, uint16_t color)
+{
+  if ((x < 0) || (x > LCD_WIDTH-1) ||
+     (y < 0) || (y > LCD_HEIGHT-1))
+    return;
+
+  LCD_SetAddressWindow(x, y, x, y);
+  LCD_WriteData(&color, 1);
+}
+
+#if !defined LCD_LOCAL_FB && !defined LCD_BAND_FB
+/**
+ * @brief µGUI pset, without the bounds check. µGUI clips before calling
+ * @param x&y -> coordinate to Draw, must be on screen
+ * @param color -> color of the Pixel
+ * @return none
+ */
+static void LCD_Pset(int16_t x, int16_t y, uint16_t color)
+{
+  LCD_SetAddressWindow(x, y, x, y);
+  LCD_WriteData(&color, 1);
+}
+#endif
+
+#if !defined LCD_LOCAL_FB && !defined LCD_BAND_FB
+/**
+ * @brief Draw a batch of pixels in a single CS cycle. Pixels are sorted so neighbours on the same row are sent as one run,
+ *        and the window cache skips the CASET/RASET that didn't change
+ * @param p -> pixel list, reordered
+ * @param count -> number of pixels
+ * @param color -> color of the pixels
+ * @return none
+ */
+static int8_t LCD_DrawPixels(UG_POINT *p, uint16_t count, uint16_t color)
+{
+  for(uint16_t i=1; i<count; i++){                                    // Insertion sort by row, then column. Batches are small and mostly ordered
+    UG_POINT t = p[i];
+    uint16_t j = i;
+    for(; j && (p[j-1].y>t.y || (p[j-1].y==t.y && p[j-1].x>t.x)); j--)
+      p[j] = p[j-1];
+    p[j] = t;
+  }
+  LCD_WaitBus();
+  bus->begin();
+  for(uint16_t i=0; i<count; ){
+    int16_t x0 = p[i].x, x1 = p[i].x, y = p[i].y;
+    for(i++; i<count && p[i].y==y && p[i].x<=x1+1; i++){              // Duplicates and adjacent pixels
+      x1 = p[i].x;
+    }
+    LCD_SendWindow(x0, y, x1, y);
+    bus->fill(color, x1-x0+1);
+  }
+  bus->end();
+  return UG_RESULT_OK;
+}
+#endif
+
+#ifdef LCD_LOCAL_FB
+#if LCD_FB_BPP!=16
+/**
+ * @brief Returns the palette slot for a color. New colors take a free slot, or the closest color once the palette is full
+ * @param color -> RGB565 color
+ * @return palette index
+ */
+static uint8_t LCD_FB_Index(uint16_t color)
+{
+  static uint8_t last;
+  uint32_t best_dist = UINT32_MAX;
+  uint8_t best = 0;
+
+  if(last<fb_colors && fb_palette[last]==color)              // Drawing usually repeats the same color
+    return last;
+  for(uint16_t i=0; i<fb_colors; i++){
+    if(fb_palette[i]==color)
+      return last = i;
+  }
+  if(fb_colors<LCD_FB_COLORS){
+    fb_palette[fb_colors] = color;
+    return last = fb_colors++;
+  }
+  for(uint16_t i=0; i<fb_colors; i++){
+    int32_t dr = ((color>>11)&0x1F) - ((fb_palette[i]>>11)&0x1F);
+    int32_t dg = ((color>>5)&0x3F) - ((fb_palette[i]>>5)&0x3F);
+    int32_t db = (color&0x1F) - (fb_palette[i]&0x1F);
+    uint32_t dist = 4*dr*dr + dg*dg + 4*db*db;                 // Red and blue have one bit less
+    if(dist<best_dist){
+      best_dist = dist;
+      best = i;
     }
   }
+  return best;
+}
+
+/**
+ * @brief Sets a row span of the framebuffer to a palette index
+ * @param x0&x1 -> span limits, already clipped
+ * @param y -> row
+ * @param idx -> palette index
+ * @return none
+ */
+static void LCD_FB_SetSpan(int16_t x0, int16_t x1, int16_t y, uint8_t idx)
+{
+  uint32_t i = x0+((uint32_t)y*LCD_WIDTH), end = x1+((uint32_t)y*LCD_WIDTH);
+#if LCD_FB_BPP==8
+  memset(&fb[i], idx, end-i+1);
+#else
+  if(i&1){                                                     // Odd first pixel, high nibble
+    fb[i>>1] = (fb[i>>1]&0x0F) | (idx<<4);
+    if(i++==end)
+      return;
+  }
+  if(!(end&1)){                                                // Even last pixel, low nibble
+    fb[end>>1] = (fb[end>>1]&0xF0) | idx;
+    if(end--==i)
+      return;
+  }
+  memset(&fb[i>>1], idx|(idx<<4), (end-i+1)>>1);
+#endif
 }
 
+/**
+ * @brief Expands a row span of the framebuffer to RGB565
+ * @param x0&x1 -> span limits
+ * @param y -> row
+ * @param dst -> output pixels
+ * @return none
+ */
+static void LCD_FB_ExpandRow(int16_t x0, int16_t x1, int16_t y, uint16_t *dst)
+{
+  uint32_t i = x0+((uint32_t)y*LCD_WIDTH), end = x1+((uint32_t)y*LCD_WIDTH);
+  for(; i<=end; i++){
+#if LCD_FB_BPP==8
+    *dst++ = fb_palette[fb[i]];
+#else
+    *dst++ = fb_palette[(fb[i>>1]>>((i&1)*4)) & 0x0F];
+#endif
+  }
+}
 
-#ifdef USE_DMA
-#define DMA_Min_Pixels    32             // Don't use DMA for small transfers? Setting this to 1 will always use DMA
-#define mem_increase      1
-#define mem_fixed         0
+/**
+ * @brief Sets the framebuffer palette. Pixels already drawn keep their indexes and take the new colors on the next update
+ * @param colors -> RGB565 colors
+ * @param count -> number of colors. Free slots are assigned to new colors as they are drawn
+ * @return none
+ */
+void LCD_FB_SetPalette(const uint16_t *colors, uint16_t count)
+{
+  if(count>LCD_FB_COLORS)
+    count = LCD_FB_COLORS;
+  memcpy(fb_palette, colors, count*sizeof(uint16_t));
+  fb_colors = count;
+  LCD_FB_MarkDirty(0, 0, LCD_WIDTH-1, LCD_HEIGHT-1);
+}
+#endif
 
 /**
- * @brief Configures DMA/ SPI interface
- * @param memInc Enable/disable memory address increase
- * @param mode16 Enable/disable 16 bit mode (disabled = 8 bit)
+ * @brief Waits until the areas sent by the last update have left the framebuffer, so drawing can't tear them
+ * @param none
  * @return none
  */
-static void setDMAMemMode(uint8_t memInc, uint8_t size)
+static inline void LCD_FB_Wait(void)
 {
-  setSPI_Size(size);
-  if(config.dma_sz!=size || config.dma_mem_inc!=memInc){
-    config.dma_sz =size;
-    config.dma_mem_inc = memInc;
-    __HAL_DMA_DISABLE(LCD_HANDLE.hdmatx);;
-#ifdef DMA_SxCR_EN
-    while((LCD_HANDLE.hdmatx->Instance->CR & DMA_SxCR_EN) != RESET);
-#elif defined DMA_CCR_EN
-    while((LCD_HANDLE.hdmatx->Instance->CCR & DMA_CCR_EN) != RESET);
+#if LCD_FB_BPP==16 && defined LCD_ASYNC_DMA
+  while((int32_t)(queue.tail-fb_ticket) < 0) LCD_IDLE();
 #endif
-    if(memInc==mem_increase){
-      LCD_HANDLE.hdmatx->Init.MemInc = DMA_MINC_ENABLE;
-#ifdef DMA_SxCR_EN
-      LCD_HANDLE.hdmatx->Instance->CR |= DMA_SxCR_MINC;
-#elif defined DMA_CCR_EN
-      LCD_HANDLE.hdmatx->Instance->CCR |= DMA_CCR_MINC;
+}
+
+void LCD_DrawPixelFB(int16_t x, int16_t y, uint16_t color)
+{
+  if ((x < 0) || (x >= LCD_WIDTH) ||
+     (y < 0) || (y >= LCD_HEIGHT)) return;
+
+  LCD_PsetFB(x, y, color);
+}
+
+/**
+ * @brief µGUI pset, without the bounds check. µGUI clips before calling
+ * @param x&y -> coordinate to Draw, must be on screen
+ * @param color -> color of the Pixel
+ * @return none
+ */
+static void LCD_PsetFB(int16_t x, int16_t y, uint16_t color)
+{
+  LCD_FB_Wait();
+#if LCD_FB_BPP==16
+  fb[x+(y*LCD_WIDTH)] = color;
+#else
+  LCD_FB_SetSpan(x, x, y, LCD_FB_Index(color));
 #endif
+  if(!dirty_cnt || x<dirty[dirty_cnt-1].x0 || x>dirty[dirty_cnt-1].x1 ||          // Most pixels fall in the last marked area
+     y<dirty[dirty_cnt-1].y0 || y>dirty[dirty_cnt-1].y1){
+    LCD_FB_MarkDirty(x, y, x, y);
+  }
+}
+
+/**
+ * @brief Adds an area to the framebuffer dirty list. Areas overlapping or closer than LCD_FB_DIRTY_GAP are merged.
+ *        When the list is full, the area is merged into the one that grows the least.
+ * @param x0&y0&x1&y1 -> changed area
+ * @return none
+ */
+void LCD_FB_MarkDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  uint8_t i;
+
+  if(x0<0) x0 = 0;
+  if(y0<0) y0 = 0;
+  if(x1>LCD_WIDTH-1) x1 = LCD_WIDTH-1;
+  if(y1>LCD_HEIGHT-1) y1 = LCD_HEIGHT-1;
+  if(x1<x0 || y1<y0)
+    return;
+
+  for(i=0; i<dirty_cnt; ){
+    rect_t *r = &dirty[i];
+    if(x0 <= r->x1+LCD_FB_DIRTY_GAP && x1 >= r->x0-LCD_FB_DIRTY_GAP &&
+       y0 <= r->y1+LCD_FB_DIRTY_GAP && y1 >= r->y0-LCD_FB_DIRTY_GAP){
+      if(r->x0<x0) x0 = r->x0;                                 // Merge and remove it, the result might now touch other areas
+      if(r->y0<y0) y0 = r->y0;
+      if(r->x1>x1) x1 = r->x1;
+      if(r->y1>y1) y1 = r->y1;
+      *r = dirty[--dirty_cnt];
+      i = 0;
+      continue;
     }
-    else{
-      LCD_HANDLE.hdmatx->Init.MemInc = DMA_MINC_DISABLE;
-#ifdef DMA_SxCR_EN
-      LCD_HANDLE.hdmatx->Instance->CR &= ~(DMA_SxCR_MINC);
-#elif defined DMA_CCR_EN
-      LCD_HANDLE.hdmatx->Instance->CCR &= ~(DMA_CCR_MINC);
+    i++;
+  }
+  if(dirty_cnt==LCD_FB_DIRTY_RECTS){                           // List full, merge with the area that grows the least
+    uint32_t best_cost = UINT32_MAX;
+    uint8_t best = 0;
+    for(i=0; i<dirty_cnt; i++){
+      rect_t *r = &dirty[i];
+      uint32_t w = (r->x1>x1 ? r->x1 : x1) - (r->x0<x0 ? r->x0 : x0) + 1;
+      uint32_t h = (r->y1>y1 ? r->y1 : y1) - (r->y0<y0 ? r->y0 : y0) + 1;
+      uint32_t cost = w*h - (uint32_t)(r->x1-r->x0+1)*(r->y1-r->y0+1);
+      if(cost<best_cost){
+        best_cost = cost;
+        best = i;
+      }
+    }
+    rect_t r = dirty[best];
+    dirty[best] = dirty[--dirty_cnt];
+    LCD_FB_MarkDirty(r.x0<x0 ? r.x0 : x0, r.y0<y0 ? r.y0 : y0, r.x1>x1 ? r.x1 : x1, r.y1>y1 ? r.y1 : y1);
+    return;
+  }
+  dirty[dirty_cnt].x0 = x0;
+  dirty[dirty_cnt].y0 = y0;
+  dirty[dirty_cnt].x1 = x1;
+  dirty[dirty_cnt].y1 = y1;
+  dirty_cnt++;
+}
+
+/**
+ * @brief Clips an area to the screen
+ * @param x0&y0&x1&y1 -> area, adjusted in place
+ * @return 0 if nothing is left
+ */
+static uint8_t LCD_ClipFB(int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1)
+{
+  if(*x0<0) *x0 = 0;
+  if(*y0<0) *y0 = 0;
+  if(*x1>LCD_WIDTH-1) *x1 = LCD_WIDTH-1;
+  if(*y1>LCD_HEIGHT-1) *y1 = LCD_HEIGHT-1;
+  return (*x0<=*x1 && *y0<=*y1);
+}
+
+/**
+ * @brief Framebuffer fill. The first row is filled, then copied to the rest
+ * @param x0&y0&x1&y1 -> area to fill
+ * @param color -> fill color
+ * @return UG_RESULT_OK
+ */
+static int8_t LCD_FillFB(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+#if LCD_FB_BPP==16
+  uint16_t *row, w;
+  if(!LCD_ClipFB(&x0, &y0, &x1, &y1))
+    return UG_RESULT_OK;
+  LCD_FB_Wait();
+  w = x1-x0+1;
+  row = &fb[x0+(y0*LCD_WIDTH)];
+  UG_KernelFill16(row, color, w);
+  if(w==LCD_WIDTH){
+    for(uint32_t done=1, left=y1-y0; left; ){                 // Contiguous rows, double the copied block every pass
+      uint32_t n = done<left ? done : left;
+      memcpy(row+done*LCD_WIDTH, row, n*LCD_WIDTH*2);
+      done += n;
+      left -= n;
+    }
+  }
+  else{
+    uint16_t *dst = row;
+    for(int16_t r=y0+1; r<=y1; r++){
+      dst += LCD_WIDTH;
+      memcpy(dst, row, w*2);
+    }
+  }
+#else
+  uint8_t idx = LCD_FB_Index(color);
+  if(!LCD_ClipFB(&x0, &y0, &x1, &y1))
+    return UG_RESULT_OK;
+  for(int16_t r=y0; r<=y1; r++){
+    LCD_FB_SetSpan(x0, x1, r, idx);
+  }
+#endif
+  LCD_FB_MarkDirty(x0, y0, x1, y1);
+  return UG_RESULT_OK;
+}
+
+/**
+ * @brief Framebuffer span fill, each span is a one row LCD_FillFB
+ * @param spans -> span list
+ * @param count -> number of spans
+ * @return none
+ */
+static int8_t LCD_FillSpansFB(const UG_SPAN *spans, uint16_t count)
+{
+  for(; count; count--, spans++){
+    LCD_FillFB(spans->xs, spans->y, spans->xe, spans->y, spans->c);
+  }
+  return UG_RESULT_OK;
+}
+
+/**
+ * @brief Framebuffer line draw (Only for vertical/horizontal lines)
+ * @param x0&y0&x1&y1 -> line ends
+ * @param color -> color of the line to Draw
+ * @return UG_RESULT_OK, or UG_RESULT_FAIL if the line must be drawn by software
+ */
+static int8_t LCD_DrawLineFB(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+  if(x0==x1){                                   // If vertical
+    if(y0>y1) swap(y0,y1);
+  }
+  else if(y0==y1){                              // If horizontal
+    if(x0>x1) swap(x0,x1);
+  }
+  else{                                         // Else, return fail, draw using software
+    return UG_RESULT_FAIL;
+  }
+  return LCD_FillFB(x0,y0,x1,y1,color);
+}
+
+static struct{
+  int16_t x0, y0, x1, y1;
+  int16_t x, y;                                 // Write position
+}fb_area;
+
+/**
+ * @brief Writes pixels at the current framebuffer area position, wrapping at the area edge like the controller does
+ * @param pixels -> pixel count
+ * @param color -> pixel color
+ * @return none
+ */
+static void LCD_PushPixelsFB(uint32_t pixels, uint16_t color)
+{
+  while(pixels && fb_area.y<=fb_area.y1){
+    int16_t x0 = fb_area.x, x1;
+    uint32_t len = fb_area.x1-x0+1;
+    if(len>pixels)
+      len = pixels;
+    x1 = x0+len-1;
+    if(fb_area.y>=0 && fb_area.y<LCD_HEIGHT){
+      if(x0<0) x0 = 0;
+      if(x1>LCD_WIDTH-1) x1 = LCD_WIDTH-1;
+      if(x0<=x1)
+#if LCD_FB_BPP==16
+        UG_KernelFill16(&fb[x0+(fb_area.y*LCD_WIDTH)], color, x1-x0+1);
+#else
+        LCD_FB_SetSpan(x0, x1, fb_area.y, LCD_FB_Index(color));
 #endif
     }
+    pixels -= len;
+    fb_area.x += len;
+    if(fb_area.x>fb_area.x1){
+      fb_area.x = fb_area.x0;
+      fb_area.y++;
+    }
+  }
+}
+
+/**
+ * @brief Sets the framebuffer area and returns the pixel writer for uGUI driver acceleration
+ * @param xi&yi -> coordinates of the area
+ * @return pixel writer
+ */
+static void(*LCD_FillAreaFB(int16_t x0, int16_t y0, int16_t x1, int16_t y1))(uint32_t, uint16_t)
+{
+  if(x0==-1){
+    return NULL;
+  }
+  fb_area.x0 = fb_area.x = x0;
+  fb_area.y0 = fb_area.y = y0;
+  fb_area.x1 = x1;
+  fb_area.y1 = y1;
+  LCD_FB_Wait();                                // Pixels are written from the returned function, wait once here
+  LCD_FB_MarkDirty(x0, y0, x1, y1);             // Clipped there, mark the whole area once
+  return LCD_PushPixelsFB;
+}
 
-    if(size==mode_16bit){
-      LCD_HANDLE.hdmatx->Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
-      LCD_HANDLE.hdmatx->Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
-#ifdef DMA_SxCR_EN
-      LCD_HANDLE.hdmatx->Instance->CR = (LCD_HANDLE.hdmatx->Instance->CR & ~(DMA_SxCR_PSIZE_Msk | DMA_SxCR_MSIZE_Msk)) |
-                                                   (1<<DMA_SxCR_PSIZE_Pos | 1<<DMA_SxCR_MSIZE_Pos);
-#elif defined DMA_CCR_EN
-      LCD_HANDLE.hdmatx->Instance->CCR = (LCD_HANDLE.hdmatx->Instance->CCR & ~(DMA_CCR_PSIZE_Msk | DMA_CCR_MSIZE_Msk)) |
-                                                   (1<<DMA_CCR_PSIZE_Pos | 1<<DMA_CCR_MSIZE_Pos);
+/**
+ * @brief Framebuffer image draw, copied row by row and clipped to the screen
+ * @param x&y -> screen position of the part
+ * @param bmp -> image, 16bpp or indexed
+ * @param xs&ys&xe&ye -> part of the image to draw
+ * @return UG_RESULT_FAIL if the image format isn't supported
+ */
+static int8_t LCD_DrawImageAreaFB(int16_t x, int16_t y, UG_BMP* bmp, int16_t xs, int16_t ys, int16_t xe, int16_t ye)
+{
+  int16_t x0 = x, y0 = y, x1 = x+xe-xs, y1 = y+ye-ys;
+  const uint16_t *src;
+  if(bmp->bpp!=BMP_BPP_16 && !bmp->palette)
+    return UG_RESULT_FAIL;
+  if(!LCD_ClipFB(&x0, &y0, &x1, &y1))
+    return UG_RESULT_OK;
+  LCD_FB_Wait();
+  if((bmp->colors & BMP_RLE) || bmp->palette){  // Decoded straight into the framebuffer
+    UG_BMP_READER rle;
+    uint16_t n;
+    UG_BMPReadInit(&rle, bmp);
+    UG_BMPSkip(&rle, (xs+x0-x) + (uint32_t)(ys+y0-y)*bmp->width);
+    for(int16_t r=y0; r<=y1; r++){
+      for(int16_t c=x0; c<=x1; c+=n){
+        n = UG_BMPRead(&rle, x1-c+1, &src);
+#if LCD_FB_BPP==16
+        if(rle.run)
+          UG_KernelFill16(&fb[c+(r*LCD_WIDTH)], *src, n);
+        else
+          memcpy(&fb[c+(r*LCD_WIDTH)], src, n*2);
+#else
+        if(rle.run)
+          LCD_FB_SetSpan(c, c+n-1, r, LCD_FB_Index(*src));
+        else
+          for(uint16_t i=0; i<n; i++)
+            LCD_FB_SetSpan(c+i, c+i, r, LCD_FB_Index(src[i]));
+#endif
+      }
+      if(r<y1)
+        UG_BMPSkip(&rle, bmp->width-(x1-x0+1));
+    }
+    LCD_FB_MarkDirty(x0, y0, x1, y1);
+    return UG_RESULT_OK;
+  }
+  src = (const uint16_t*)bmp->p + (xs+x0-x) + (uint32_t)(ys+y0-y)*bmp->width;
+  for(int16_t r=y0; r<=y1; r++, src+=bmp->width){
+#if LCD_FB_BPP==16
+    memcpy(&fb[x0+(r*LCD_WIDTH)], src, (x1-x0+1)*2);
+#else
+    for(int16_t c=x0; c<=x1; c++){
+      LCD_FB_SetSpan(c, c, r, LCD_FB_Index(src[c-x0]));
+    }
+#endif
+  }
+  LCD_FB_MarkDirty(x0, y0, x1, y1);
+  return UG_RESULT_OK;
+}
+
+static void LCD_DrawImageFB(int16_t x, int16_t y, UG_BMP* bmp)
+{
+  LCD_DrawImageAreaFB(x, y, bmp, 0, 0, bmp->width-1, bmp->height-1);
+}
 #endif
 
+#ifdef LCD_BAND_FB
+/**
+ * @brief Reserves space in the display list. If full, draws the recorded frame and starts a new list
+ * @param words -> entry size in words
+ * @return pointer to the entry
+ */
+static uint16_t *LCD_BandAlloc(uint16_t words)
+{
+  uint16_t *p;
+  if(dl_len+words > LCD_BAND_DL_SIZE){
+    LCD_BandRender();                                   // Draw what we have, the frame will be sent in several passes
+    if(dl_area.open){                                   // Reopen the pixel area where it was left
+      uint16_t w = dl_area.x1-dl_area.x0+1;
+      p = &dl[dl_len];
+      dl_len += 6;
+      p[0] = DL_AREA;
+      p[1] = dl_area.x0;
+      p[2] = dl_area.y0+dl_area.pushed/w;
+      p[3] = dl_area.x1;
+      p[4] = dl_area.y1;
+      p[5] = dl_area.x0+dl_area.pushed%w;
+    }
+  }
+  p = &dl[dl_len];
+  dl_len += words;
+  return p;
+}
+
+static void LCD_DrawPixelBand(int16_t x, int16_t y, uint16_t color)
+{
+  uint16_t *p = LCD_BandAlloc(4);
+
+  p[0] = DL_PIXEL;
+  p[1] = x;
+  p[2] = y;
+  p[3] = color;
+}
+
+static int8_t LCD_FillBand(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+  uint16_t *p;
+  if(x1<0 || y1<0 || x0>=LCD_WIDTH || y0>=LCD_HEIGHT)
+    return UG_RESULT_OK;
+  p = LCD_BandAlloc(6);
+  p[0] = DL_RECT;
+  p[1] = x0;
+  p[2] = y0;
+  p[3] = x1;
+  p[4] = y1;
+  p[5] = color;
+  return UG_RESULT_OK;
+}
+
+static int8_t LCD_FillSpansBand(const UG_SPAN *spans, uint16_t count)
+{
+  for(; count; count--, spans++){
+    LCD_FillBand(spans->xs, spans->y, spans->xe, spans->y, spans->c);
+  }
+  return UG_RESULT_OK;
+}
+
+static int8_t LCD_DrawLineBand(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+  if(x0==x1){                                   // If vertical
+    if(y0>y1) swap(y0,y1);
+  }
+  else if(y0==y1){                              // If horizontal
+    if(x0>x1) swap(x0,x1);
+  }
+  else{                                         // Else, return fail, draw using software
+    return UG_RESULT_FAIL;
+  }
+  return LCD_FillBand(x0,y0,x1,y1,color);
+}
+
+static void LCD_PushPixelsBand(uint32_t pixels, uint16_t color)
+{
+  while(pixels){
+    uint16_t count = pixels > 65535 ? 65535 : pixels;
+    uint16_t *p = LCD_BandAlloc(3);
+    p[0] = DL_RUN;
+    p[1] = count;
+    p[2] = color;
+    dl_area.pushed += count;
+    pixels -= count;
+  }
+}
+
+static void(*LCD_FillAreaBand(int16_t x0, int16_t y0, int16_t x1, int16_t y1))(uint32_t, uint16_t)
+{
+  uint16_t *p;
+  if(x0==-1){
+    dl_area.open = 0;
+    return NULL;
+  }
+  dl_area.open = 0;                             // Don't reopen the previous area if this entry fills the list
+  p = LCD_BandAlloc(6);
+  p[0] = DL_AREA;
+  p[1] = x0;
+  p[2] = y0;
+  p[3] = x1;
+  p[4] = y1;
+  p[5] = x0;
+  dl_area.x0 = x0;
+  dl_area.y0 = y0;
+  dl_area.x1 = x1;
+  dl_area.y1 = y1;
+  dl_area.pushed = 0;
+  dl_area.open = 1;
+  return LCD_PushPixelsBand;
+}
+
+static int8_t LCD_DrawImageAreaBand(int16_t x, int16_t y, UG_BMP* bmp, int16_t xs, int16_t ys, int16_t xe, int16_t ye)
+{
+  const uint16_t *src = (const uint16_t*)bmp->p + (uint32_t)ys*bmp->width + xs;
+  uint16_t *p, w = xe-xs+1, h = ye-ys+1;
+  if(bmp->bpp!=BMP_BPP_16 || (bmp->colors & BMP_RLE))        // RLE and indexed images are recorded through DRIVER_FILL_AREA
+    return UG_RESULT_FAIL;
+  if(bmp->colors & BMP_RAM){                    // Data won't last until the bands are drawn, store it as pixel runs
+    uint16_t i, n;
+    LCD_FillAreaBand(x, y, x+w-1, y+h-1);
+    for(; h; h--, src+=bmp->width){
+      for(i=0; i<w; i+=n){
+        for(n=1; i+n<w && src[i+n]==src[i]; n++);
+        LCD_PushPixelsBand(n, src[i]);
+      }
     }
-    else{
-      LCD_HANDLE.hdmatx->Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
-      LCD_HANDLE.hdmatx->Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
-#ifdef DMA_SxCR_EN
-      LCD_HANDLE.hdmatx->Instance->CR = (LCD_HANDLE.hdmatx->Instance->CR & ~(DMA_SxCR_PSIZE_Msk | DMA_SxCR_MSIZE_Msk));
-#elif defined DMA_CCR_EN
-      LCD_HANDLE.hdmatx->Instance->CCR = (LCD_HANDLE.hdmatx->Instance->CCR & ~(DMA_CCR_PSIZE_Msk | DMA_CCR_MSIZE_Msk));
-#endif
-    }
+    return UG_RESULT_OK;
   }
+  p = LCD_BandAlloc(6+DL_PTR_WORDS);
+  p[0] = DL_BMP;
+  p[1] = x;
+  p[2] = y;
+  p[3] = w;
+  p[4] = h;
+  p[5] = bmp->width;
+  memcpy(&p[6], &src, sizeof(src));
+  return UG_RESULT_OK;
+}
+
+static void LCD_DrawImageBand(int16_t x, int16_t y, UG_BMP* bmp)
+{
+  LCD_DrawImageAreaBand(x, y, bmp, 0, 0, bmp->width-1, bmp->height-1);
 }
-#endif
 
 /**
- * @brief Write command to ST7735 controller
- * @param cmd -> command to write
+ * @brief Draws a horizontal span into the band, clipped to the screen
+ * @param buf -> band buffer
+ * @param row -> band row
+ * @param x0&x1 -> span limits
+ * @param color -> span color, used if src is NULL
+ * @param src -> pixel data for the span
  * @return none
  */
-static void LCD_WriteCommand(uint8_t *cmd, uint8_t argc)
+static void LCD_BandSpan(uint16_t *buf, uint16_t row, int16_t x0, int16_t x1, uint16_t color, const uint16_t *src)
 {
-  setSPI_Size(mode_8bit);
-  LCD_PIN(LCD_DC,RESET);
-#ifdef LCD_CS
-  LCD_PIN(LCD_CS,RESET);
-#endif
-  HAL_SPI_Transmit(&LCD_HANDLE, cmd, 1, HAL_MAX_DELAY);
-  if(argc){
-    LCD_PIN(LCD_DC,SET);
-    HAL_SPI_Transmit(&LCD_HANDLE, (cmd+1), argc, HAL_MAX_DELAY);
+  uint32_t i;
+  if(x0<0){
+    if(src) src -= x0;
+    x0 = 0;
+  }
+  if(x1>=LCD_WIDTH)
+    x1 = LCD_WIDTH-1;
+  for(i=row*LCD_WIDTH+x0; x0<=x1; x0++, i++){
+    buf[i] = src ? *src++ : color;
+    band_cover[i>>3] |= 1<<(i&7);
   }
-#ifdef LCD_CS
-  LCD_PIN(LCD_CS,SET);
-#endif
 }
 
 /**
- * @brief Write data to ST7735 controller
- * @param buff -> pointer of data buffer
- * @param buff_size -> size of the data buffer
+ * @brief Replays the display list into a band
+ * @param buf -> band buffer
+ * @param by0&by1 -> screen rows covered by the band
  * @return none
  */
-static void LCD_WriteData(uint8_t *buff, size_t buff_size)
+static void LCD_BandDraw(uint16_t *buf, int16_t by0, int16_t by1)
 {
-  LCD_PIN(LCD_DC,SET);
-#ifdef LCD_CS
-  LCD_PIN(LCD_CS,RESET);
-#endif
-
-  // split data in small chunks because HAL can't send more than 64K at once
-
-  while (buff_size > 0) {
-    uint16_t chunk_size = buff_size > 65535 ? 65535 : buff_size;
-#ifdef USE_DMA
-    if(buff_size>DMA_Min_Pixels){
-      HAL_SPI_Transmit_DMA(&LCD_HANDLE, buff, chunk_size);
-      while(HAL_DMA_GetState(LCD_HANDLE.hdmatx)!=HAL_DMA_STATE_READY);
-      if(config.dma_mem_inc==mem_increase){
-        if(config.dma_sz==mode_16bit)
-          buff += chunk_size;
-        else
-          buff += chunk_size*2;
+  uint16_t i = 0;
+  while(i<dl_len){
+    uint16_t *p = &dl[i];
+    switch(p[0]){
+      case DL_RECT:
+      {
+        int16_t y = (int16_t)p[2] < by0 ? by0 : (int16_t)p[2];
+        int16_t y1 = (int16_t)p[4] > by1 ? by1 : (int16_t)p[4];
+        for(; y<=y1; y++)
+          LCD_BandSpan(buf, y-by0, p[1], p[3], p[5], NULL);
+        i += 6;
+        break;
       }
+      case DL_PIXEL:
+        if((int16_t)p[2]>=by0 && (int16_t)p[2]<=by1)
+          LCD_BandSpan(buf, p[2]-by0, p[1], p[1], p[3], NULL);
+        i += 4;
+        break;
+      case DL_AREA:
+      {
+        int16_t ax0 = p[1], ax1 = p[3], ay1 = p[4];
+        int16_t x = p[5], y = p[2];
+        uint16_t w = ax1-ax0+1;
+        for(i += 6; i<dl_len && dl[i]==DL_RUN; i += 3){
+          uint32_t count = dl[i+1];
+          if(y>by1 || y>ay1)                              // Past the band, skip the remaining pixels
+            continue;
+          if(y<by0 && x==ax0 && count>=w){                // Skip whole rows above the band
+            uint32_t skip = count/w;
+            if(skip > (uint32_t)(by0-y))
+              skip = by0-y;
+            y += skip;
+            count -= skip*w;
+          }
+          while(count){
+            uint16_t len = ax1-x+1;
+            if(len>count)
+              len = count;
+            if(y>=by0 && y<=by1)
+              LCD_BandSpan(buf, y-by0, x, x+len-1, dl[i+2], NULL);
+            x += len;
+            count -= len;
+            if(x>ax1){
+              x = ax0;
+              y++;
+            }
+          }
+        }
+        break;
+      }
+      case DL_BMP:
+      {
+        const uint16_t *src;
+        int16_t y, y1;
+        memcpy(&src, &p[6], sizeof(src));
+        y = (int16_t)p[2] < by0 ? by0 : (int16_t)p[2];
+        y1 = (int16_t)p[2]+(int16_t)p[4]-1 > by1 ? by1 : (int16_t)p[2]+(int16_t)p[4]-1;
+        for(; y<=y1; y++)
+          LCD_BandSpan(buf, y-by0, p[1], p[1]+p[3]-1, 0, src + (uint32_t)(y-(int16_t)p[2])*p[5]);
+        i += 6+DL_PTR_WORDS;
+        break;
+      }
+      default:
+        i = dl_len;
+        break;
     }
-    else{
-      HAL_SPI_Transmit(&LCD_HANDLE, buff, chunk_size, HAL_MAX_DELAY);
-      if(config.spi_sz==mode_16bit)
-        buff += chunk_size;
-      else
-        buff += chunk_size*2;
-    }
-#else
-    HAL_SPI_Transmit(&LCD_HANDLE, buff, chunk_size, HAL_MAX_DELAY);
-#endif
-    buff_size -= chunk_size;
   }
-#ifdef LCD_CS
-  LCD_PIN(LCD_CS,SET);
-#endif
 }
 
 /**
- * @brief Write data to ST7735 controller, simplify for 8bit data.
- * data -> data to write
+ * @brief Sends a block of pixels to the screen
+ * @param x0&y0&x1&y1 -> screen window
+ * @param data -> pixel data
  * @return none
  */
-
-static void LCD_ReadCmd(uint8_t cmd, uint8_t *data, uint8_t count)
+static void LCD_BandWrite(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t *data)
 {
-  setSPI_Size(mode_8bit);
-  LCD_PIN(LCD_CS,RESET);
-  LCD_PIN(LCD_DC,RESET);
-  HAL_SPI_Transmit(&LCD_HANDLE, &cmd, sizeof(cmd), HAL_MAX_DELAY);
-  LCD_PIN(LCD_DC,SET);
-  HAL_SPI_Receive(&LCD_HANDLE, data, count, HAL_MAX_DELAY);
-  LCD_PIN(LCD_CS,SET);
+  uint32_t pixels = (uint32_t)(x1-x0+1)*(y1-y0+1);
+#ifdef LCD_ASYNC_DMA
+  LCD_Enqueue(x0, y0, x1, y1, data, pixels, 0, 0);
+#else
+  LCD_SetAddressWindow(x0, y0, x1, y1);
+  LCD_WriteData(data, pixels);
+#endif
 }
 
 /**
- * @brief Set the rotation direction of the display
- * @param m -> rotation parameter(please refer it in ST7735.h)
+ * @brief Sends the drawn pixels of a band. Fully drawn areas are sent in one transfer, else row by row
+ * @param buf -> band buffer
+ * @param y -> first screen row of the band
+ * @param rows -> band height
  * @return none
  */
-void LCD_SetRotation(uint8_t m)
+static void LCD_BandSend(uint16_t *buf, int16_t y, uint8_t rows)
 {
-  uint8_t cmd[] = { CMD_MADCTL, 0};
+  int16_t bx0 = LCD_WIDTH, bx1 = -1, by0 = -1, by1 = -1;
+  uint8_t full = 1;
+  int16_t x, r;
 
-  m = m % 4; // can't be higher than 3
+  for(r=0; r<rows; r++){                                // Find the drawn area
+    for(x=0; x<LCD_WIDTH; x++){
+      uint32_t i = r*LCD_WIDTH+x;
+      if(band_cover[i>>3] & (1<<(i&7))){
+        if(x<bx0) bx0 = x;
+        if(x>bx1) bx1 = x;
+        if(by0<0) by0 = r;
+        by1 = r;
+      }
+    }
+  }
+  if(bx1<0)
+    return;
+  for(r=by0; r<=by1 && full; r++){                      // Check if it was completely drawn
+    for(x=bx0; x<=bx1; x++){
+      uint32_t i = r*LCD_WIDTH+x;
+      if(!(band_cover[i>>3] & (1<<(i&7)))){
+        full = 0;
+        break;
+      }
+    }
+  }
+  if(full){
+    uint16_t w = bx1-bx0+1;
+    if(w<LCD_WIDTH || by0){                             // Pack the rows so they can be sent in a single transfer
+      for(r=by0; r<=by1; r++)
+        memmove(&buf[(r-by0)*w], &buf[r*LCD_WIDTH+bx0], w*2);
+    }
+    LCD_BandWrite(bx0, y+by0, bx1, y+by1, buf);
+    return;
+  }
+  for(r=by0; r<=by1; r++){                              // Send the drawn spans of every row
+    for(x=bx0; x<=bx1; x++){
+      uint32_t i = r*LCD_WIDTH+x;
+      if(band_cover[i>>3] & (1<<(i&7))){
+        int16_t x1 = x;
+        while(x1<bx1 && (band_cover[(i+1)>>3] & (1<<((i+1)&7)))){
+          x1++;
+          i++;
+        }
+        LCD_BandWrite(x, y+r, x1, y+r, &buf[r*LCD_WIDTH+x]);
+        x = x1;
+      }
+    }
+  }
+}
 
-  switch (m)
-  {
-  case 0:
-#if LCD_IS_160X80
-    cmd[1] = CMD_MADCTL_MX | CMD_MADCTL_MY | CMD_MADCTL_BGR;
-#else
-    cmd[1] = CMD_MADCTL_MX | CMD_MADCTL_MY | CMD_MADCTL_RGB;
-#endif
-    break;
-  case 1:
-#if CMD_IS_160X80
-    cmd[1] = CMD_MADCTL_MY | CMD_MADCTL_MV | CMD_MADCTL_BGR;
-#else
-    cmd[1] = CMD_MADCTL_MY | CMD_MADCTL_MV | CMD_MADCTL_RGB;
-#endif
-    break;
-  case 2:
-#if CMD_IS_160X80
-    cmd[1] = CMD_MADCTL_BGR;
-#else
-    cmd[1] = CMD_MADCTL_RGB;
+/**
+ * @brief Renders the recorded frame band by band and sends it. Only the pixels drawn in this frame are sent
+ * @param none
+ * @return none
+ */
+static void LCD_BandRender(void)
+{
+  uint8_t b = 0;
+  if(!dl_len)
+    return;
+  for(int16_t y=0; y<LCD_HEIGHT; y+=LCD_BAND_LINES, b^=1){
+    uint8_t rows = (LCD_HEIGHT-y) < LCD_BAND_LINES ? (LCD_HEIGHT-y) : LCD_BAND_LINES;
+#ifdef LCD_ASYNC_DMA
+    while((int32_t)(queue.tail-band_ticket[b]) < 0) LCD_IDLE(); // Wait until the previous transfers from this buffer are done
 #endif
-    break;
-  case 3:
-#if CMD_IS_160X80
-    cmd[1] = CMD_MADCTL_MX | CMD_MADCTL_MV | CMD_MADCTL_BGR;
-#else
-    cmd[1] = CMD_MADCTL_MX | CMD_MADCTL_MV | CMD_MADCTL_RGB;
+    memset(band_cover, 0, sizeof(band_cover));
+    LCD_BandDraw(band[b], y, y+rows-1);
+    LCD_BandSend(band[b], y, rows);
+#ifdef LCD_ASYNC_DMA
+    band_ticket[b] = queue.head;
 #endif
-    break;
   }
-  LCD_WriteCommand(cmd, sizeof(cmd)-1);
+  dl_len = 0;
 }
+#endif
 
+void LCD_FillPixels(uint32_t pixels, uint16_t color){
+  LCD_WaitBus();
+  bus->begin();
+  bus->fill(color, pixels);
+  bus->end();
+}
 
 /**
- * @brief Set address of DisplayWindow
- * @param xi&yi -> coordinates of window
+ * @brief Pixel output returned by LCD_FillArea. Pixels are collected in a buffer and sent in one transfer
+ *        when it's full, on the next window or bus access, or at the end of the drawing.
+ * @param pixels -> pixel count
+ * @param color -> pixel color
  * @return none
  */
-static void LCD_SetAddressWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+static void LCD_PushPixels(uint32_t pixels, uint16_t color)
 {
-  int16_t x_start = x0 + LCD_X_SHIFT, x_end = x1 + LCD_X_SHIFT;
-  int16_t y_start = y0 + LCD_Y_SHIFT, y_end = y1 + LCD_Y_SHIFT;
-
-  /* Column Address set */
-  {
-    uint8_t cmd[] = { CMD_CASET, x_start >> 8, x_start & 0xFF, x_end >> 8, x_end & 0xFF };
-    LCD_WriteCommand(cmd, sizeof(cmd)-1);
-  }
-  /* Row Address set */
-  {
-    uint8_t cmd[] = { CMD_RASET, y_start >> 8, y_start & 0xFF, y_end >> 8, y_end & 0xFF };
-    LCD_WriteCommand(cmd, sizeof(cmd)-1);
+  if(pixels>=LCD_SINK_SIZE){                                                                      // Long run, fill it directly
+    LCD_WaitBus();
+    bus->begin();
+    bus->fill(color, pixels);
+    bus->end();
+    return;
   }
-  {
-  /* Write to RAM */
-    uint8_t cmd[] = { CMD_RAMWR };
-    LCD_WriteCommand(cmd, sizeof(cmd)-1);
+  while(pixels--){
+    sink.buf[sink.len++] = color;
+    if(sink.len==LCD_SINK_SIZE){
+      LCD_SinkFlush();
+    }
   }
 }
 
-
 /**
- * @brief Address and draw a Pixel
- * @param x&y -> coordinate to Draw
- * @param color -> color of the Pixel
+ * @brief Adds pixel data to the sink, blocks longer than the sink are sent directly
+ * @param pixels -> pixel data
+ * @param count -> pixel count
  * @return none
  */
-void LCD_DrawPixel(int16_t x, int16_t y, uint16_t color)
+static void LCD_PushData(const uint16_t *pixels, uint32_t count)
 {
-  if ((x < 0) || (x > LCD_WIDTH-1) ||
-     (y < 0) || (y > LCD_HEIGHT-1))
+  if(count>=LCD_SINK_SIZE){
+    LCD_WaitBus();
+    bus->begin();
+    bus->write(pixels, count);
+    bus->end();
     return;
-
-  uint8_t data[2] = {color >> 8, color & 0xFF};
-
-  LCD_SetAddressWindow(x, y, x, y);
-
-  LCD_PIN(LCD_DC,SET);
-#ifdef LCD_CS
-  LCD_PIN(LCD_CS,RESET);
-#endif
-  HAL_SPI_Transmit(&LCD_HANDLE, data, sizeof(data), HAL_MAX_DELAY);
-#ifdef LCD_CS
-  LCD_PIN(LCD_CS,SET);
-#endif
-}
-
-#ifdef LCD_LOCAL_FB
-void LCD_DrawPixelFB(int16_t x, int16_t y, uint16_t color)
-{
-  if ((x < 0) || (x >= LCD_WIDTH) ||
-     (y < 0) || (y >= LCD_HEIGHT)) return;
-
-  fb[x+(y*LCD_WIDTH)] = color;
-}
-#endif
-
-void LCD_FillPixels(uint32_t pixels, uint16_t color){
-#ifdef USE_DMA
-  if(pixels>DMA_Min_Pixels)
-    LCD_WriteData((uint8_t*)&color, pixels);
-  else{
-#endif
-    uint16_t fill[DMA_Min_Pixels];                                                                // Use a pixel buffer for faster filling, removes overhead.
-    for(uint32_t t=0;t<(pixels<DMA_Min_Pixels ? pixels : DMA_Min_Pixels);t++){                     // Fill the buffer with the color
-      fill[t]=color;
-    }
-    while(pixels){                                                                                // Send 64 pixel blocks
-      uint32_t sz = (pixels<DMA_Min_Pixels ? pixels : DMA_Min_Pixels);
-      LCD_WriteData((uint8_t*)fill, sz);
-      pixels-=sz;
-    }
-#ifdef USE_DMA
   }
-#endif
+  if(sink.len+count > LCD_SINK_SIZE){
+    LCD_SinkFlush();
+  }
+  memcpy(&sink.buf[sink.len], pixels, count*2);
+  sink.len += count;
+  if(sink.len==LCD_SINK_SIZE){                  // LCD_PushPixels expects some room
+    LCD_SinkFlush();
+  }
 }
 
 /**
@@ -390,21 +1450,11 @@ void LCD_FillPixels(uint32_t pixels, uint16_t color){
  */
 void(*LCD_FillArea(int16_t x0, int16_t y0, int16_t x1, int16_t y1))(uint32_t, uint16_t){
   if(x0==-1){
-#ifdef USE_DMA
-    setDMAMemMode(mem_increase, mode_8bit);
-#else
-    setSPI_Size(mode_8bit);                                                          // Set SPI to 8 bit
-#endif
+    LCD_SinkFlush();
     return NULL;
   }
-  LCD_SetAddressWindow(x0,y0,x1,y1);
-#ifdef USE_DMA
-    setDMAMemMode(mem_fixed, mode_16bit);
-#else
-    setSPI_Size(mode_16bit);                                                          // Set SPI to 16 bit
-#endif
-  LCD_PIN(LCD_DC,SET);
-  return LCD_FillPixels;
+  LCD_SetAddressWindow(x0,y0,x1,y1);                                  // Flushes the previous area
+  return LCD_PushPixels;
 }
 
 
@@ -418,55 +1468,190 @@ void(*LCD_FillArea(int16_t x0, int16_t y0, int16_t x1, int16_t y1))(uint32_t, ui
 int8_t LCD_Fill(uint16_t xSta, uint16_t ySta, uint16_t xEnd, uint16_t yEnd, uint16_t color)
 {
   uint32_t pixels = (uint32_t)(xEnd-xSta+1)*(yEnd-ySta+1);
-  LCD_SetAddressWindow(xSta, ySta, xEnd, yEnd);
-#ifdef USE_DMA
-    setDMAMemMode(mem_fixed, mode_16bit);
-#else
-    setSPI_Size(mode_16bit);
+#ifdef LCD_ASYNC_DMA
+  if(pixels>ASYNC_Min_Pixels){
+    LCD_Enqueue(xSta, ySta, xEnd, yEnd, NULL, pixels, color, 0);
+    return UG_RESULT_OK;
+  }
 #endif
+  LCD_SetAddressWindow(xSta, ySta, xEnd, yEnd);
   LCD_FillPixels(pixels, color);
-#ifdef USE_DMA
-  setDMAMemMode(mem_increase, mode_8bit);
-#else
-  setSPI_Size(mode_8bit);
-#endif
   return UG_RESULT_OK;
 }
 
+#if !defined LCD_LOCAL_FB && !defined LCD_BAND_FB
+/**
+ * @brief Fill a batch of horizontal spans in a single CS cycle. Stacked spans with the same color are sent as one rectangle
+ * @param spans -> span list
+ * @param count -> number of spans
+ * @return none
+ */
+static int8_t LCD_FillSpans(const UG_SPAN *spans, uint16_t count)
+{
+  LCD_WaitBus();
+  bus->begin();
+  while(count){
+    int16_t y0 = spans->y, y1 = spans->y;
+    int16_t x0 = spans->xs, x1 = spans->xe;
+    uint16_t color = spans->c;
+    for(spans++, count--; count && spans->y==y1+1 && spans->xs==x0 && spans->xe==x1 && spans->c==color; spans++, count--){
+      y1++;
+    }
+    if(y1<0 || y0>=LCD_HEIGHT || x1<0 || x0>=LCD_WIDTH)
+      continue;
+    if(y0<0) y0 = 0;                            // Clip, the window must stay inside the screen
+    if(y1>=LCD_HEIGHT) y1 = LCD_HEIGHT-1;
+    if(x0<0) x0 = 0;
+    if(x1>=LCD_WIDTH) x1 = LCD_WIDTH-1;
+    LCD_SendWindow(x0, y0, x1, y1);
+    bus->fill(color, (uint32_t)(x1-x0+1)*(y1-y0+1));
+  }
+  bus->end();
+  return UG_RESULT_OK;
+}
+#endif
+
 
 /**
- * @brief Draw an Image on the screen
- * @param x&y -> start point of the Image
- * @param w&h -> width & height of the Image to Draw
- * @param data -> pointer of the Image array
+ * @brief Draws part of a BMP_RLE or indexed image. Runs are sent as fills, stored pixels are copied.
+ *        With LCD_ASYNC_DMA each row is decoded into a buffer while the previous one is being sent,
+ *        rows of a single color are queued as fills
+ * @param x&y -> screen position of the part
+ * @param w&h -> size of the part, already clipped
+ * @param bmp -> image
+ * @param xs&ys -> top left corner of the part in the image
  * @return none
  */
-void LCD_DrawImage(uint16_t x, uint16_t y, UG_BMP* bmp)
+static void LCD_DrawImageRuns(int16_t x, int16_t y, uint16_t w, uint16_t h, UG_BMP* bmp, int16_t xs, int16_t ys)
 {
-  uint16_t w = bmp->width;
-  uint16_t h = bmp->height;
-  if ((x > LCD_WIDTH-1) || (y > LCD_HEIGHT-1))
-    return;
-  if ((x + w - 1) > LCD_WIDTH-1)
-    return;
-  if ((y + h - 1) > LCD_HEIGHT-1)
-    return;
-  if(bmp->bpp!=BMP_BPP_16)
-    return;
-  LCD_SetAddressWindow(x, y, x + w - 1, y + h - 1);
-
-  #ifdef USE_DMA
-  setDMAMemMode(mem_increase, mode_16bit);                                                            // Set SPI and DMA to 16 bit, enable memory increase
-  #else
-  setSPI_Size(mode_16bit);                                                                            // Set SPI to 16 bit
-  #endif
-  LCD_WriteData((uint8_t*)bmp->p, w*h);
-#ifdef USE_DMA
-setDMAMemMode(mem_increase, mode_8bit);                                                            // Set SPI and DMA to 16 bit, enable memory increase
+  UG_BMP_READER r;
+  const uint16_t *px;
+  uint32_t i, n, row = w, rows = h;
+
+  UG_BMPReadInit(&r, bmp);
+  UG_BMPSkip(&r, (uint32_t)ys*bmp->width + xs);
+#ifdef LCD_ASYNC_DMA
+  uint8_t b = 0;
+  (void)row;
+  while(rows){
+    n = UG_BMPRead(&r, w, &px);
+    if(r.run && n==w){                                                                                // Whole row in one color, no decoding
+      uint32_t fill = 1;
+      if(w==bmp->width){                                                                              // Rows are contiguous, the run can cover the next ones too
+        fill += r.left/w;
+        if(fill>rows)
+          fill = rows;
+        UG_BMPSkip(&r, (fill-1)*w);
+      }
+      LCD_Enqueue(x, y, x+w-1, y+fill-1, NULL, fill*w, *px, 0);
+      y += fill;
+      rows -= fill;
+    }
+    else{
+      while((int32_t)(queue.tail-img_ticket[b]) < 0) LCD_IDLE();                                       // Wait until the row sent from this buffer is done
+      for(i=0; ; ){
+        if(r.run)
+          UG_KernelFill16(&img_line[b][i], *px, n);
+        else
+          memcpy(&img_line[b][i], px, n*2);
+        i += n;
+        if(i==w)
+          break;
+        n = UG_BMPRead(&r, w-i, &px);
+      }
+      LCD_Enqueue(x, y, x+w-1, y, img_line[b], w, 0, 0);
+      img_ticket[b] = queue.head;
+      b ^= 1;
+      y++;
+      rows--;
+    }
+    if(rows)
+      UG_BMPSkip(&r, bmp->width-w);
+  }
 #else
-setSPI_Size(mode_8bit);                                                                            // Set SPI to 16 bit
+  LCD_SetAddressWindow(x, y, x+w-1, y+h-1);
+  if(w==bmp->width){                                                                                  // Rows are contiguous, runs can cross them
+    row = (uint32_t)w*h;
+    rows = 1;
+  }
+  for(; rows; rows--){
+    for(i=0; i<row; i+=n){
+      n = UG_BMPRead(&r, row-i > 0xFFFF ? 0xFFFF : row-i, &px);
+      if(r.run)
+        LCD_PushPixels(n, *px);                                                                       // Long runs are filled directly
+      else
+        LCD_PushData(px, n);
+    }
+    if(rows>1)
+      UG_BMPSkip(&r, bmp->width-w);
+  }
+  LCD_SinkFlush();
+#endif
+}
+
+/**
+ * @brief Draw part of an Image, clipped to the screen. A single address window, the rows are sent with the image stride
+ * @param x&y -> screen position of the part
+ * @param bmp -> image, 16bpp or indexed
+ * @param xs&ys&xe&ye -> part of the image to draw, must be inside the image
+ * @return UG_RESULT_FAIL if the image format isn't supported
+ */
+int8_t LCD_DrawImageArea(int16_t x, int16_t y, UG_BMP* bmp, int16_t xs, int16_t ys, int16_t xe, int16_t ye)
+{
+  const uint16_t *src;
+  uint16_t w, h;
+  if(bmp->bpp!=BMP_BPP_16 && !bmp->palette)
+    return UG_RESULT_FAIL;
+  if(x<0){ xs -= x; x = 0; }
+  if(y<0){ ys -= y; y = 0; }
+  if(xe-xs > LCD_WIDTH-1-x) xe = xs+LCD_WIDTH-1-x;
+  if(ye-ys > LCD_HEIGHT-1-y) ye = ys+LCD_HEIGHT-1-y;
+  if(xe<xs || ye<ys)
+    return UG_RESULT_OK;
+  w = xe-xs+1;
+  h = ye-ys+1;
+  if((bmp->colors & BMP_RLE) || bmp->palette){
+    LCD_DrawImageRuns(x, y, w, h, bmp, xs, ys);
+    return UG_RESULT_OK;
+  }
+  src = (const uint16_t*)bmp->p + (uint32_t)ys*bmp->width + xs;
+#ifdef LCD_ASYNC_DMA
+  if(!(bmp->colors & BMP_RAM) && (w==bmp->width || w>=LCD_SINK_SIZE)){                              // Short strided rows are faster packed in the sink
+    LCD_Enqueue(x, y, x+w-1, y+h-1, src, (uint32_t)w*h, 0, (w<bmp->width) ? bmp->width : 0);       // Image data is constant, no need to wait
+    return UG_RESULT_OK;
+  }
 #endif
+  LCD_SetAddressWindow(x, y, x+w-1, y+h-1);
+  if(w==bmp->width){                                                                                  // Full rows, contiguous
+    LCD_WriteData(src, (uint32_t)w*h);
+  }
+  else if(w<LCD_SINK_SIZE){                                                                           // Short rows, packed in the sink so each transfer is as long as possible
+    for(; h; h--, src+=bmp->width){
+      LCD_PushData(src, w);
+    }
+    LCD_SinkFlush();
   }
+  else{
+    LCD_WaitBus();
+    bus->begin();
+    for(; h; h--, src+=bmp->width){                                                                   // One row at a time, the controller keeps filling the window
+      bus->write(src, w);
+    }
+    bus->end();
+  }
+  return UG_RESULT_OK;
+}
+
+/**
+ * @brief Draw an Image on the screen, clipped to the screen
+ * @param x&y -> start point of the Image
+ * @param bmp -> image, 16bpp or indexed
+ * @return none
+ */
+void LCD_DrawImage(uint16_t x, uint16_t y, UG_BMP* bmp)
+{
+  LCD_DrawImageArea(x, y, bmp, 0, 0, bmp->width-1, bmp->height-1);
+}
 
 /**
  * @brief Accelerated line draw using filling (Only for vertical/horizontal lines)
@@ -529,23 +1714,133 @@ void LCD_setPower(uint8_t power)
   LCD_WriteCommand(cmd, sizeof(cmd)-1);
 }
 
+/**
+ * @brief Sends the hardware scroll state to the controller
+ * @param none
+ * @return none
+ */
+static void LCD_SendScroll(void)
+{
+  uint16_t bfa = LCD_GRAM_HEIGHT-scroll.tfa-scroll.vsa;
+  uint8_t def[] = { CMD_VSCRDEF, scroll.tfa>>8, scroll.tfa, scroll.vsa>>8, scroll.vsa, bfa>>8, bfa };
+  uint8_t sad[] = { CMD_VSCSAD, scroll.vsp>>8, scroll.vsp };
+  uint8_t noron[] = { CMD_NORON };
+
+#if defined LCD_LOCAL_FB || defined LCD_BAND_FB
+  scroll.pending = 0;
+#endif
+  if(!scroll.vsa){                                                                                    // Back to normal display mode, rows shown as stored
+    LCD_WriteCommand(noron, sizeof(noron)-1);
+    return;
+  }
+  if(scroll.area_changed){
+    LCD_WriteCommand(def, sizeof(def)-1);
+    scroll.area_changed = 0;
+  }
+  LCD_WriteCommand(sad, sizeof(sad)-1);
+}
+
+/**
+ * @brief Hardware vertical scroll. The rows ys-ye are shown starting with row top, the rows before it follow after ye.
+ *        Nothing is redrawn, only the start address changes. The controller scrolls its own rows, so the rotations
+ *        with MADCTL MV set (landscape) can't scroll vertically
+ * @param ys&ye -> scroll area, whole screen width. ys -1 ends scrolling
+ * @param top -> row shown at ys, between ys and ye
+ * @return UG_RESULT_FAIL if the current rotation can't scroll vertically
+ */
+int8_t LCD_VScroll(int16_t ys, int16_t ye, int16_t top)
+{
+  uint16_t tfa, vsa;
+  if(config.madctl & CMD_MADCTL_MV)
+    return UG_RESULT_FAIL;
+  if(ys<0){
+    if(!scroll.vsa)
+      return UG_RESULT_OK;
+    scroll.vsa = 0;
+  }
+  else{
+    if(ye<ys || ye>=LCD_HEIGHT || top<ys || top>ye)
+      return UG_RESULT_FAIL;
+    vsa = ye-ys+1;
+    if(config.madctl & CMD_MADCTL_MY){                                                                // Rows stored bottom up, the area starts at ye and scrolls the other way
+      tfa = LCD_GRAM_HEIGHT-1-(ye+LCD_Y_SHIFT);
+      scroll.vsp = tfa+(ys+vsa-top)%vsa;
+    }
+    else{
+      tfa = ys+LCD_Y_SHIFT;
+      scroll.vsp = tfa+top-ys;
+    }
+    if(tfa!=scroll.tfa || vsa!=scroll.vsa){
+      scroll.tfa = tfa;
+      scroll.vsa = vsa;
+      scroll.area_changed = 1;
+    }
+  }
+#if defined LCD_LOCAL_FB || defined LCD_BAND_FB
+  scroll.pending = 1;                                                                                 // The exposed rows are only in the framebuffer yet
+#else
+  LCD_SendScroll();
+#endif
+  return UG_RESULT_OK;
+}
+
 static void LCD_Update(void)
 {
-#ifdef LCD_LOCAL_FB
-  setSPI_Size(mode_8bit);
-  LCD_SetAddressWindow(0,0,LCD_WIDTH-1,LCD_HEIGHT-1);
-  #ifdef USE_DMA
-  setDMAMemMode(mem_increase, mode_16bit);                                                            // Set SPI and DMA to 16 bit, enable memory increase
-  #else
-  setSPI_Size(mode_16bit);                                                                            // Set SPI to 16 bit
-  #endif
-  LCD_WriteData((uint8_t*)fb, LCD_WIDTH*LCD_HEIGHT);
-#endif
-  #ifdef USE_DMA
-  setDMAMemMode(mem_increase, mode_8bit);                                                            // Set SPI and DMA to 16 bit, enable memory increase
-  #else
-  setSPI_Size(mode_8bit);                                                                            // Set SPI to 16 bit
-  #endif
+#ifdef LCD_BAND_FB
+  LCD_BandRender();
+  if(scroll.pending)
+    LCD_SendScroll();                                                                                 // Waits for the bands
+#ifdef LCD_ASYNC_DMA
+  return;                                                                                             // Bands are still being sent, don't wait here
+#endif
+#elif defined LCD_LOCAL_FB
+  for(uint8_t i=0; i<dirty_cnt; i++){                                                                 // Send only the changed areas
+    rect_t *r = &dirty[i];
+    uint16_t w = r->x1-r->x0+1;
+#if LCD_FB_BPP==16
+    uint16_t *src = &fb[r->x0+(r->y0*LCD_WIDTH)];
+#ifdef LCD_ASYNC_DMA
+    LCD_Enqueue(r->x0, r->y0, r->x1, r->y1, src, (uint32_t)w*(r->y1-r->y0+1), 0,                    // Sent straight from the framebuffer, drawing waits for fb_ticket
+                (w<LCD_WIDTH) ? LCD_WIDTH : 0);
+    fb_ticket = queue.head;
+#else
+    LCD_SetAddressWindow(r->x0, r->y0, r->x1, r->y1);
+    if(w==LCD_WIDTH){                                                                                 // Full width, rows are contiguous
+      LCD_WriteData(src, (uint32_t)w*(r->y1-r->y0+1));
+    }
+    else{
+      for(int16_t y=r->y0; y<=r->y1; y++, src+=LCD_WIDTH){                                            // One row at a time, the controller keeps filling the window
+        LCD_WriteData(src, w);
+      }
+    }
+#endif
+#else
+    uint8_t b = 0;
+    uint16_t rows = (uint16_t)(LCD_WIDTH*LCD_FB_LINES/w);                                             // Rows that fit in a line buffer
+#ifndef LCD_ASYNC_DMA
+    LCD_SetAddressWindow(r->x0, r->y0, r->x1, r->y1);
+#endif
+    for(int16_t y=r->y0; y<=r->y1; y+=rows, b^=1){                                                    // Expand to RGB565 a band of rows at a time
+      uint16_t n = (r->y1-y+1 < rows) ? r->y1-y+1 : rows;
+#ifdef LCD_ASYNC_DMA
+      while((int32_t)(queue.tail-fb_line_ticket[b]) < 0) LCD_IDLE();                                  // Wait until the band sent from this buffer is done
+#endif
+      for(uint16_t i=0; i<n; i++){
+        LCD_FB_ExpandRow(r->x0, r->x1, y+i, &fb_line[b][i*w]);
+      }
+#ifdef LCD_ASYNC_DMA
+      LCD_Enqueue(r->x0, y, r->x1, y+n-1, fb_line[b], (uint32_t)w*n, 0, 0);                          // One window per band
+      fb_line_ticket[b] = queue.head;
+#else
+      LCD_WriteData(fb_line[b], (uint32_t)w*n);
+#endif
+    }
+#endif
+  }
+  dirty_cnt = 0;
+  if(scroll.pending)
+    LCD_SendScroll();
+#endif
 }
 /**
  * @brief Initialize ST7735 controller
@@ -565,11 +1860,31 @@ void LCD_init(void)
   HAL_Delay(200);
 #endif
   UG_Init(&gui, &device);
-#ifndef LCD_LOCAL_FB
+#ifdef LCD_BAND_FB
+  UG_DriverRegister(DRIVER_DRAW_LINE, LCD_DrawLineBand);
+  UG_DriverRegister(DRIVER_FILL_FRAME, LCD_FillBand);
+  UG_DriverRegister(DRIVER_FILL_AREA, LCD_FillAreaBand);
+  UG_DriverRegister(DRIVER_DRAW_BMP, LCD_DrawImageBand);
+  UG_DriverRegister(DRIVER_FILL_SPANS, LCD_FillSpansBand);
+  UG_DriverRegister(DRIVER_BLIT, LCD_DrawImageAreaBand);
+  UG_DriverRegister(DRIVER_VSCROLL, LCD_VScroll);
+#elif defined LCD_LOCAL_FB
+  UG_DriverRegister(DRIVER_DRAW_LINE, LCD_DrawLineFB);
+  UG_DriverRegister(DRIVER_FILL_FRAME, LCD_FillFB);
+  UG_DriverRegister(DRIVER_FILL_AREA, LCD_FillAreaFB);
+  UG_DriverRegister(DRIVER_DRAW_BMP, LCD_DrawImageFB);
+  UG_DriverRegister(DRIVER_FILL_SPANS, LCD_FillSpansFB);
+  UG_DriverRegister(DRIVER_BLIT, LCD_DrawImageAreaFB);
+  UG_DriverRegister(DRIVER_VSCROLL, LCD_VScroll);
+#else
   UG_DriverRegister(DRIVER_DRAW_LINE, LCD_DrawLine);
   UG_DriverRegister(DRIVER_FILL_FRAME, LCD_Fill);
   UG_DriverRegister(DRIVER_FILL_AREA, LCD_FillArea);
   UG_DriverRegister(DRIVER_DRAW_BMP, LCD_DrawImage);
+  UG_DriverRegister(DRIVER_FILL_SPANS, LCD_FillSpans);
+  UG_DriverRegister(DRIVER_DRAW_PIXELS, LCD_DrawPixels);
+  UG_DriverRegister(DRIVER_BLIT, LCD_DrawImageArea);
+  UG_DriverRegister(DRIVER_VSCROLL, LCD_VScroll);
 #endif
   UG_FontSetHSpace(0);
   UG_FontSetVSpace(0);
@@ -577,6 +1892,7 @@ void LCD_init(void)
     LCD_WriteCommand((uint8_t*)&init_cmd[i+1], init_cmd[i]);
     i += init_cmd[i]+2;
   }
+  LCD_InvalidateWindow();               // Window was reset or set by init_cmd
   UG_FillScreen(C_BLACK);               //  Clear screen
   LCD_setPower(ENABLE);
   UG_Update();
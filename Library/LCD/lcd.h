@@ -4,6 +4,7 @@
 #include "images.h"
 #include "ugui.h"
 #include "main.h"
+#include "lcd_transport.h"
 
 /* choose a Hardware SPI port to use. */
 #define LCD_HANDLE            hspi1
@@ -15,12 +16,33 @@
 //#define LCD_BL              LCD_BL  /* Enable if you need backlight control */
 
 #define USE_DMA                       /* Use DMA for transfers when possible */
+//#define LCD_ASYNC_DMA               /* Queue large DMA transfers and return without waiting. Needs USE_DMA and the SPI TX DMA interrupt enabled */
+#ifndef LCD_IDLE
+#define LCD_IDLE()                    /* Run while waiting for queued transfers, ex. __WFI() */
+#endif
+//#define LCD_USER_SPI_CALLBACK       /* The application defines HAL_SPI_TxCpltCallback() and calls LCD_SPI_TxCplt() from it */
 //#define LCD_LOCAL_FB                /* Use local framebuffer. Needs a lot of ram, but removes flickering and redrawing glitches  */
+#ifndef LCD_FB_BPP
+#define LCD_FB_BPP         16         /* Local framebuffer depth. 16: RGB565. 8 or 4: palette indexes, 256 or 16 colors, expanded to RGB565 when sent */
+#endif
+#define LCD_FB_LINES       4          /* 8 or 4 bpp: rows expanded per transfer, narrow areas fit more. Uses 2 x LCD_WIDTH x LCD_FB_LINES x 2 bytes of ram */
+#define LCD_FB_DIRTY_RECTS 8          /* Changed areas tracked in the local framebuffer, only those are sent on update */
+#define LCD_FB_DIRTY_GAP   8          /* Merge changed areas closer than this, one larger transfer is cheaper than two address windows */
+//#define LCD_BAND_FB                 /* Record the draw calls and render each frame in small bands on UG_Update(). Removes flickering using much less ram than LCD_LOCAL_FB */
+#define LCD_BAND_LINES    12          /* Band height. Uses 2 x LCD_WIDTH x LCD_BAND_LINES x 2 bytes of ram */
+#define LCD_BAND_DL_SIZE  2048        /* Display list size in 16 bit words. If a frame doesn't fit, it's drawn in several passes */
+#define LCD_SINK_SIZE     128         /* Pixel buffer for DRIVER_FILL_AREA pushes (bitmaps, 8bpp fonts), sent in one transfer when full */
+//#define LCD_FSMC                    /* Parallel 8080 bus through FSMC/FMC instead of SPI. 16 bit bus, COLMOD must match the panel interface */
+#define LCD_FSMC_BASE     0x60000000  /* FSMC bank address the panel is mapped to */
+#define LCD_FSMC_RS       18          /* Address line wired to the panel D/C (RS) pin, ex. A18 */
+//#define LCD_BENCH                   /* Build the LCD_Bench() benchmark suite. Needs the DWT cycle counter (Cortex-M3 and up) */
 
 //#define USE_ST7735                    /* LCD Selection */
 #define USE_ST7789
 
-#define LCD_ROTATION 3                /* XY rotation/mirroring. Valid values: 0...3 */
+#ifndef LCD_ROTATION
+#define LCD_ROTATION 3                /* XY rotation/mirroring. Valid values: 0...3. 1 and 3 are landscape, the hardware vertical scroll needs 0 or 2 */
+#endif
 
 #ifdef USE_ST7735                     /* ST7735 LCD sizes */
   #define LCD_160X128
@@ -34,8 +56,28 @@
 
 
 
+#if defined LCD_ASYNC_DMA && !defined USE_DMA
+  #error "LCD_ASYNC_DMA needs USE_DMA"
+#endif
+#if defined LCD_BAND_FB && defined LCD_LOCAL_FB
+  #error "Enable only one of LCD_LOCAL_FB and LCD_BAND_FB"
+#endif
+#if defined LCD_FSMC && defined LCD_ASYNC_DMA
+  #error "LCD_ASYNC_DMA is only supported by the SPI bus"
+#endif
+
+#ifndef LCD_TRANSPORT                 /* Default bus, LCD_SetTransport() can change it at runtime */
+  #if defined LCD_FSMC
+    #define LCD_TRANSPORT lcd_fsmc_transport
+  #elif defined USE_DMA
+    #define LCD_TRANSPORT lcd_spi_dma_transport
+  #else
+    #define LCD_TRANSPORT lcd_spi_transport
+  #endif
+#endif
 
 #ifdef USE_ST7735
+  #define LCD_GRAM_HEIGHT 162             /* Controller memory rows, the vertical scroll areas add up to this */
   #ifdef LCD_160X128
     #define LCD_X_SHIFT 0
     #define LCD_Y_SHIFT 0
@@ -89,6 +131,7 @@
     #endif
   #endif
 #elif defined USE_ST7789
+  #define LCD_GRAM_HEIGHT 320
   #ifdef LCD_135X240
     #if (LCD_ROTATION == 0) || (LCD_ROTATION == 2)
       #define LCD_WIDTH  135
@@ -176,7 +219,9 @@ typedef enum{
   CMD_RAMWR      = 0x2C,
   CMD_RAMRD      = 0x2E,
   CMD_PTLAR      = 0x30,
+  CMD_VSCRDEF    = 0x33,
   CMD_MADCTL     = 0x36,
+  CMD_VSCSAD     = 0x37,
   CMD_IDMOFF     = 0x38,
   CMD_IDMON      = 0x39,
   CMD_COLMOD     = 0x3A,
@@ -223,17 +268,22 @@ typedef enum{
 #define LCD_CON(a,b)  a##b
 #define LCD_PIN(pin, out)   ( LCD_CON(pin,_GPIO_Port->BSRR) = (out ? LCD_CON(pin,_Pin) : LCD_CON(pin,_Pin)<<16 ))
 
+#ifndef LCD_FSMC
 extern SPI_HandleTypeDef    LCD_HANDLE;
+#endif
 
 void LCD_init(void);
 void LCD_SetRotation(uint8_t m);
 void LCD_DrawPixel(int16_t x, int16_t y, uint16_t color);
 void LCD_DrawPixelFB(int16_t x, int16_t y, uint16_t color);
+void LCD_FB_MarkDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+void LCD_FB_SetPalette(const uint16_t *colors, uint16_t count);
 int8_t LCD_Fill(uint16_t xSta, uint16_t ySta, uint16_t xEnd, uint16_t yEnd, uint16_t color);
 
 /* Graphical functions. */
 int8_t LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
 void LCD_DrawImage(uint16_t x, uint16_t y, UG_BMP* bmp);
+int8_t LCD_DrawImageArea(int16_t x, int16_t y, UG_BMP* bmp, int16_t xs, int16_t ys, int16_t xe, int16_t ye);
 void LCD_InvertColors(uint8_t invert);
 
 /* Text functions. */
@@ -243,8 +293,24 @@ void LCD_PutStr(uint16_t x, uint16_t y,  char *str, UG_FONT* font, uint16_t colo
 /* Extended Graphical functions. */
 /* Command functions */
 void LCD_TearEffect(uint8_t tear);
+int8_t LCD_VScroll(int16_t ys, int16_t ye, int16_t top);
+uint32_t LCD_GetSkippedCommands(void);
+uint32_t LCD_GetBusBytes(void);
+
+/* Transfer queue functions. */
+void LCD_FlushQueue(void);
+#ifdef LCD_ASYNC_DMA
+uint8_t LCD_QueueBusy(void);
+void LCD_SetTransferCallback(void (*cb)(void));
+#ifndef LCD_FSMC
+void LCD_SPI_TxCplt(SPI_HandleTypeDef *hspi);
+#endif
+#endif
 
 /* Simple test function. */
 void LCD_Test(void);
 
+/* Benchmark, prints CSV results. */
+void LCD_Bench(void (*print)(const char *line));
+
 #endif // __ST7735_H__
@@ -0,0 +1,364 @@
+#include "lcd.h"
+#include <stdio.h>
+
+/*
+ * Benchmark suite. Times every primitive with the DWT cycle counter and prints the results as CSV lines:
+ *
+ *   # lcd_bench,<core clock>,<width>x<height>,<bus>
+ *   test,size,runs,min,median,max,bytes,bytes_per_s
+ *
+ * size is the primitive size (side, length or radius in pixels, font height for text).
+ * Shapes are sized from the shorter screen side, so they are never clipped.
+ * kernel_ tests run the pixel kernels over a RAM buffer of size pixels, the _c lines are the plain C versions.
+ * bmp_area draws a size x size part of the image, bmp_clip the image half off screen.
+ * Cycles include UG_Update() and waiting for queued transfers, so all configurations are comparable.
+ * bytes is what the last run sent on the bus, commands included, as counted by the transport.
+ * For the kernel_ tests it's the pixels processed (2 bytes per pixel). bytes_per_s is computed from the median.
+ */
+
+#ifdef LCD_BENCH
+
+#ifndef LCD_BENCH_RUNS
+#define LCD_BENCH_RUNS  9                                               // Runs per test and size, odd so the median is a sample
+#endif
+
+#define BENCH_SIDE      (LCD_WIDTH<LCD_HEIGHT ? LCD_WIDTH : LCD_HEIGHT)  // Largest square on screen
+
+#if defined UGUI_USE_FONT_arial_49X57
+  #define BENCH_BIG_FONT  FONT_arial_49X57
+#elif defined UGUI_USE_FONT_12X20
+  #define BENCH_BIG_FONT  FONT_12X20
+#else
+  #define BENCH_BIG_FONT  FONT_6X8
+#endif
+
+typedef struct{
+  const char *name;
+  uint32_t (*run)(uint16_t size);                                       // Runs the test. Returns the pixels processed if it doesn't use the bus, else 0
+  uint16_t sizes[4];                                                    // 0 terminated
+}bench_t;
+
+static void (*bench_print)(const char *line);
+
+static uint32_t Bench_Fill(uint16_t size)
+{
+  UG_FillFrame(0, 0, size-1, size-1, C_RED);
+  return 0;
+}
+
+static uint32_t Bench_HLine(uint16_t size)
+{
+  UG_DrawLine(0, LCD_HEIGHT/2, size-1, LCD_HEIGHT/2, C_WHITE);
+  return 0;
+}
+
+static uint32_t Bench_VLine(uint16_t size)
+{
+  UG_DrawLine(LCD_WIDTH/2, 0, LCD_WIDTH/2, size-1, C_WHITE);
+  return 0;
+}
+
+static uint32_t Bench_Line(uint16_t size)
+{
+  UG_DrawLine(0, 0, size-1, (size-1)/2, C_YELLOW);
+  return 0;
+}
+
+static uint32_t Bench_Circle(uint16_t size)
+{
+  UG_DrawCircle(LCD_WIDTH/2, LCD_HEIGHT/2, size, C_GREEN);
+  return 0;
+}
+
+static uint32_t Bench_FillCircle(uint16_t size)
+{
+  UG_FillCircle(LCD_WIDTH/2, LCD_HEIGHT/2, size, C_MAGENTA);
+  return 0;
+}
+
+static uint32_t Bench_Triangle(uint16_t size)
+{
+  UG_FillTriangle(0, size-1, size/2, 0, size-1, size-1, C_CYAN);
+  return 0;
+}
+
+static uint32_t Bench_Text(UG_FONT *font, uint8_t transparent)
+{
+  static const char str[] = "Hello Steve!";
+  uint8_t t = UG_FontGetTransparency();
+
+  UG_FontSelect(font);
+  UG_SetForecolor(C_WHITE);
+  UG_SetBackcolor(C_BLACK);
+  UG_FontSetTransparency(transparent);
+  UG_PutString(0, 0, (char*)str);
+  UG_FontSetTransparency(t);
+  return 0;
+}
+
+static UG_FONT *Bench_Font(uint16_t size)
+{
+  if(size>=BENCH_BIG_FONT[1])
+    return BENCH_BIG_FONT;
+#ifdef UGUI_USE_FONT_12X20
+  if(size>=20)
+    return FONT_12X20;
+#endif
+  return FONT_6X8;
+}
+
+static uint32_t Bench_Text1bpp(uint16_t size)
+{
+  return Bench_Text(Bench_Font(size), 0);
+}
+
+static uint32_t Bench_TextTransparent(uint16_t size)
+{
+  return Bench_Text(Bench_Font(size), 1);
+}
+
+#ifdef UGUI_USE_FONT_arial_49X57_RLE
+static uint32_t Bench_TextRle(uint16_t size)
+{
+  return Bench_Text(FONT_arial_49X57_RLE, 0);
+}
+#endif
+
+#ifdef LCD_BENCH_FONT_8BPP
+static uint32_t Bench_Text8bpp(uint16_t size)
+{
+  return Bench_Text(LCD_BENCH_FONT_8BPP, 0);                            // No 8bpp font is enabled by default, define LCD_BENCH_FONT_8BPP to the one to test
+}
+#endif
+
+static uint32_t Bench_Bmp(uint16_t size)
+{
+  UG_DrawBMP(0, 0, &fry);
+  return 0;
+}
+
+static uint32_t Bench_BmpRle(uint16_t size)
+{
+  UG_DrawBMP(0, 0, &fry_rle);
+  return 0;
+}
+
+static uint32_t Bench_BmpIndexed(uint16_t size)
+{
+  UG_DrawBMP(0, 0, &fry_idx);
+  return 0;
+}
+
+static uint32_t Bench_BmpArea(uint16_t size)
+{
+  UG_DrawBMPArea(0, 0, &fry, 8, 8, 8+size-1, 8+size-1);                     // Square part of the image, strided rows
+  return 0;
+}
+
+static uint32_t Bench_BmpClip(uint16_t size)
+{
+  UG_DrawBMP(-fry.width/2, LCD_HEIGHT-fry.height/2, &fry);                  // Bottom left corner on screen
+  return 0;
+}
+
+/* Pixel kernels against their plain C versions, over a buffer of size pixels */
+#define BENCH_KERNEL_PIXELS 512
+static uint16_t bench_k16[BENCH_KERNEL_PIXELS];
+static uint32_t bench_k32[BENCH_KERNEL_PIXELS];
+static uint8_t bench_alpha[BENCH_KERNEL_PIXELS];
+
+static void Bench_KernelInit(void)
+{
+  for(uint16_t i=0; i<BENCH_KERNEL_PIXELS; i++){
+    bench_k16[i] = i*0x9E37;
+    bench_alpha[i] = (i&7)<3 ? 0 : (i&7)<6 ? 255 : i*37;                // Mostly background and foreground, like glyphs
+  }
+}
+
+static uint32_t Bench_KFill(uint16_t size)
+{
+  UG_KernelFill16(bench_k16, C_RED, size);
+  return size;
+}
+
+static uint32_t Bench_KFillC(uint16_t size)
+{
+  UG_KernelFill16_C(bench_k16, C_RED, size);
+  return size;
+}
+
+static uint32_t Bench_KBlend(uint16_t size)
+{
+  UG_KernelBlend565(bench_k16, bench_alpha, size, C_WHITE, C_NAVY);
+  return size;
+}
+
+static uint32_t Bench_KBlendC(uint16_t size)
+{
+  UG_KernelBlend565_C(bench_k16, bench_alpha, size, C_WHITE, C_NAVY);
+  return size;
+}
+
+static uint32_t Bench_KRgb888(uint16_t size)
+{
+  UG_KernelRGB565To888(bench_k32, bench_k16, size);
+  return size;
+}
+
+static uint32_t Bench_KRgb888C(uint16_t size)
+{
+  UG_KernelRGB565To888_C(bench_k32, bench_k16, size);
+  return size;
+}
+
+#define BENCH_OBJECTS 4
+static UG_WINDOW bench_wnd;
+static UG_BUTTON bench_btn;
+static UG_TEXTBOX bench_txb;
+static UG_PROGRESS bench_pgb;
+static UG_OBJECT bench_obj[BENCH_OBJECTS];
+
+static void Bench_WindowCallback(UG_MESSAGE *msg)
+{
+}
+
+static uint32_t Bench_Window(uint16_t size)
+{
+  UG_WindowShow(&bench_wnd);                                            // Forces a full redraw
+  return 0;
+}
+
+static void Bench_WindowCreate(void)
+{
+  UG_WindowCreate(&bench_wnd, bench_obj, BENCH_OBJECTS, Bench_WindowCallback);
+  UG_WindowSetTitleText(&bench_wnd, "Bench");
+  UG_WindowSetTitleTextFont(&bench_wnd, FONT_6X8);
+  UG_WindowSetXStart(&bench_wnd, 0);
+  UG_WindowSetYStart(&bench_wnd, 0);
+  UG_WindowSetXEnd(&bench_wnd, LCD_WIDTH-1);
+  UG_WindowSetYEnd(&bench_wnd, LCD_HEIGHT-1);
+  UG_ButtonCreate(&bench_wnd, &bench_btn, BTN_ID_0, 5, 5, 70, 35);
+  UG_ButtonSetFont(&bench_wnd, BTN_ID_0, FONT_6X8);
+  UG_ButtonSetText(&bench_wnd, BTN_ID_0, "Button");
+  UG_TextboxCreate(&bench_wnd, &bench_txb, TXB_ID_0, 5, 40, LCD_WIDTH-20, 60);
+  UG_TextboxSetFont(&bench_wnd, TXB_ID_0, FONT_6X8);
+  UG_TextboxSetText(&bench_wnd, TXB_ID_0, "Some Text");
+  UG_ProgressCreate(&bench_wnd, &bench_pgb, PGB_ID_0, 5, 65, LCD_WIDTH-20, 78);
+  UG_ProgressSetProgress(&bench_wnd, PGB_ID_0, 40);
+}
+
+static const bench_t bench_tests[] = {
+    { "fill",             Bench_Fill,            { 8, 32, BENCH_SIDE } },
+    { "hline",            Bench_HLine,           { 8, 64, LCD_WIDTH } },
+    { "vline",            Bench_VLine,           { 8, 64, LCD_HEIGHT } },
+    { "line",             Bench_Line,            { 8, 64, LCD_WIDTH } },
+    { "circle",           Bench_Circle,          { 4, 16, BENCH_SIDE/2-1 } },
+    { "fill_circle",      Bench_FillCircle,      { 4, 16, BENCH_SIDE/2-1 } },
+    { "fill_triangle",    Bench_Triangle,        { 8, 64, BENCH_SIDE } },
+    { "text_1bpp",        Bench_Text1bpp,        { 8, 20, 57 } },
+    { "text_transparent", Bench_TextTransparent, { 8, 20, 57 } },
+#ifdef UGUI_USE_FONT_arial_49X57_RLE
+    { "text_rle",         Bench_TextRle,         { 57 } },
+#endif
+#ifdef LCD_BENCH_FONT_8BPP
+    { "text_8bpp",        Bench_Text8bpp,        { 1 } },
+#endif
+    { "bmp",              Bench_Bmp,             { 1 } },
+    { "bmp_rle",          Bench_BmpRle,          { 1 } },
+    { "bmp_indexed",      Bench_BmpIndexed,      { 1 } },
+    { "bmp_area",         Bench_BmpArea,         { 16, 64 } },
+    { "bmp_clip",         Bench_BmpClip,         { 1 } },
+    { "window",           Bench_Window,          { 1 } },
+    { "kernel_fill",      Bench_KFill,           { 16, 128, BENCH_KERNEL_PIXELS } },
+    { "kernel_fill_c",    Bench_KFillC,          { 16, 128, BENCH_KERNEL_PIXELS } },
+    { "kernel_blend",     Bench_KBlend,          { 16, 128, BENCH_KERNEL_PIXELS } },
+    { "kernel_blend_c",   Bench_KBlendC,         { 16, 128, BENCH_KERNEL_PIXELS } },
+    { "kernel_rgb888",    Bench_KRgb888,         { 16, 128, BENCH_KERNEL_PIXELS } },
+    { "kernel_rgb888_c",  Bench_KRgb888C,        { 16, 128, BENCH_KERNEL_PIXELS } },
+};
+
+/**
+ * @brief Enables the DWT cycle counter if the application didn't
+ * @param none
+ * @return none
+ */
+static void Bench_InitCounter(void)
+{
+  if(!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)){
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+}
+
+static void Bench_Print(const char *line)
+{
+  if(bench_print)
+    bench_print(line);
+  else
+    printf("%s", line);                                                 // Semihosting or retargeted printf
+}
+
+/**
+ * @brief Runs every test at every size and prints the results
+ * @param print -> function sending a line to the host, ex. over UART. NULL to use printf (semihosting)
+ * @return none
+ */
+void LCD_Bench(void (*print)(const char *line))
+{
+  char line[96];
+  uint32_t cycles[LCD_BENCH_RUNS];
+
+  bench_print = print;
+  Bench_InitCounter();
+  Bench_WindowCreate();
+  Bench_KernelInit();
+
+  snprintf(line, sizeof(line), "# lcd_bench,%lu,%ux%u,%s\r\n", (unsigned long)SystemCoreClock, LCD_WIDTH, LCD_HEIGHT,
+#if defined LCD_FSMC
+      "fsmc"
+#elif defined LCD_ASYNC_DMA
+      "spi_dma_async"
+#elif defined USE_DMA
+      "spi_dma"
+#else
+      "spi"
+#endif
+      );
+  Bench_Print(line);
+  Bench_Print("test,size,runs,min,median,max,bytes,bytes_per_s\r\n");
+
+  for(uint8_t t=0; t<sizeof(bench_tests)/sizeof(bench_tests[0]); t++){
+    const bench_t *b = &bench_tests[t];
+    for(uint8_t s=0; s<4 && b->sizes[s]; s++){
+      uint32_t bytes = 0;
+      UG_FillScreen(C_BLACK);
+      UG_Update();
+      LCD_FlushQueue();
+      for(uint8_t r=0; r<LCD_BENCH_RUNS; r++){
+        uint32_t sent = LCD_GetBusBytes();
+        uint32_t start = DWT->CYCCNT;
+        uint32_t pixels = b->run(b->sizes[s]);
+        UG_Update();
+        LCD_FlushQueue();
+        cycles[r] = DWT->CYCCNT-start;
+        bytes = pixels ? pixels*2 : LCD_GetBusBytes()-sent;
+      }
+      for(uint8_t i=1; i<LCD_BENCH_RUNS; i++){                         // Sort for the median
+        uint32_t c = cycles[i];
+        uint8_t j = i;
+        for(; j && cycles[j-1]>c; j--)
+          cycles[j] = cycles[j-1];
+        cycles[j] = c;
+      }
+      snprintf(line, sizeof(line), "%s,%u,%u,%lu,%lu,%lu,%lu,%lu\r\n", b->name, b->sizes[s], LCD_BENCH_RUNS,
+          (unsigned long)cycles[0], (unsigned long)cycles[LCD_BENCH_RUNS/2], (unsigned long)cycles[LCD_BENCH_RUNS-1], (unsigned long)bytes,
+          (unsigned long)(cycles[LCD_BENCH_RUNS/2] ? (uint64_t)bytes*SystemCoreClock/cycles[LCD_BENCH_RUNS/2] : 0));
+      Bench_Print(line);
+    }
+  }
+  UG_WindowDelete(&bench_wnd);
+  UG_FillScreen(C_BLACK);
+  UG_Update();
+}
+#endif
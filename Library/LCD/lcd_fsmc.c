@@ -0,0 +1,74 @@
+#include "lcd.h"
+
+/*
+ * Parallel 8080 transport using the FSMC/FMC memory controller, 16 bit bus.
+ * The panel D/C (RS) pin is wired to an address line, so commands and data are two memory addresses.
+ * FSMC writes block until the bus is free, there are no background transfers.
+ */
+
+#ifdef LCD_FSMC
+
+#define FSMC_CMD    (*(volatile uint16_t*)(LCD_FSMC_BASE))
+#define FSMC_DATA   (*(volatile uint16_t*)(LCD_FSMC_BASE | (2UL<<LCD_FSMC_RS)))   // 16 bit bus, HADDR is shifted by one
+
+static void FSMC_None(void)
+{
+}
+
+/**
+ * @brief Send command and arguments
+ * @param cmd -> command to write
+ * @param args -> arguments
+ * @param argc -> argument count
+ * @return none
+ */
+static void FSMC_Command(uint8_t cmd, const uint8_t *args, uint8_t argc)
+{
+  lcd_bus_bytes += 1+argc;
+  FSMC_CMD = cmd;
+  while(argc--){
+    FSMC_DATA = *args++;
+  }
+}
+
+/**
+ * @brief Write pixels
+ * @param pixels -> pixel data
+ * @param count -> pixel count
+ * @return none
+ */
+static void FSMC_Write(const uint16_t *pixels, uint32_t count)
+{
+  lcd_bus_bytes += count*2;
+  while(count--){
+    FSMC_DATA = *pixels++;
+  }
+}
+
+/**
+ * @brief Repeat a pixel
+ * @param color -> pixel color
+ * @param count -> pixel count
+ * @return none
+ */
+static void FSMC_Fill(uint16_t color, uint32_t count)
+{
+  lcd_bus_bytes += count*2;
+  while(count>=8){                                                    // Unrolled, the loop overhead is close to the bus write time
+    FSMC_DATA = color; FSMC_DATA = color; FSMC_DATA = color; FSMC_DATA = color;
+    FSMC_DATA = color; FSMC_DATA = color; FSMC_DATA = color; FSMC_DATA = color;
+    count-=8;
+  }
+  while(count--){
+    FSMC_DATA = color;
+  }
+}
+
+const lcd_transport_t lcd_fsmc_transport = {
+    .begin = FSMC_None,
+    .end = FSMC_None,
+    .command = FSMC_Command,
+    .write = FSMC_Write,
+    .fill = FSMC_Fill,
+};
+#endif // LCD_FSMC
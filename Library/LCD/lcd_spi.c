@@ -0,0 +1,302 @@
+#include "lcd.h"
+
+#ifndef LCD_FSMC
+
+/*
+ * SPI transports. lcd_spi_transport uses polled transfers only,
+ * lcd_spi_dma_transport moves larger blocks with DMA and supports queued transfers.
+ */
+
+#define mode_16bit        1
+#define mode_8bit         0
+#define mem_increase      1
+#define mem_fixed         0
+
+#define DMA_Min_Pixels    32             // Don't use DMA for small transfers? Setting this to 1 will always use DMA. Also sets the size of the fill buffer.
+
+static struct{
+  int8_t spi_sz;
+  int8_t dma_sz;
+  int8_t dma_mem_inc;
+  volatile uint8_t async;                // Transfer started by SPI_DMA_Start() or SPI_DMA_StartBytes() in progress
+}spi = {
+    .spi_sz = -1,
+    .dma_sz = -1,
+    .dma_mem_inc = -1,
+};
+
+/*
+ * @brief Sets SPI interface word size (0=8bit, 1=16 bit)
+ * @param none
+ * @return none
+ */
+
+static void setSPI_Size(int8_t size){
+  if(spi.spi_sz!=size){
+    __HAL_SPI_DISABLE(&LCD_HANDLE);
+    spi.spi_sz=size;
+    if(size==mode_16bit){
+      LCD_HANDLE.Init.DataSize = SPI_DATASIZE_16BIT;
+      LCD_HANDLE.Instance->CR1 |= SPI_CR1_DFF;
+    }
+    else{
+      LCD_HANDLE.Init.DataSize = SPI_DATASIZE_8BIT;
+      LCD_HANDLE.Instance->CR1 &= ~(SPI_CR1_DFF);
+    }
+  }
+}
+
+#ifdef USE_DMA
+
+/**
+ * @brief Configures DMA/ SPI interface
+ * @param memInc Enable/disable memory address increase
+ * @param mode16 Enable/disable 16 bit mode (disabled = 8 bit)
+ * @return none
+ */
+static void setDMAMemMode(uint8_t memInc, uint8_t size)
+{
+  setSPI_Size(size);
+  if(spi.dma_sz!=size || spi.dma_mem_inc!=memInc){
+    spi.dma_sz =size;
+    spi.dma_mem_inc = memInc;
+    __HAL_DMA_DISABLE(LCD_HANDLE.hdmatx);
+#ifdef DMA_SxCR_EN
+    while((LCD_HANDLE.hdmatx->Instance->CR & DMA_SxCR_EN) != RESET);
+#elif defined DMA_CCR_EN
+    while((LCD_HANDLE.hdmatx->Instance->CCR & DMA_CCR_EN) != RESET);
+#endif
+    if(memInc==mem_increase){
+      LCD_HANDLE.hdmatx->Init.MemInc = DMA_MINC_ENABLE;
+#ifdef DMA_SxCR_EN
+      LCD_HANDLE.hdmatx->Instance->CR |= DMA_SxCR_MINC;
+#elif defined DMA_CCR_EN
+      LCD_HANDLE.hdmatx->Instance->CCR |= DMA_CCR_MINC;
+#endif
+    }
+    else{
+      LCD_HANDLE.hdmatx->Init.MemInc = DMA_MINC_DISABLE;
+#ifdef DMA_SxCR_EN
+      LCD_HANDLE.hdmatx->Instance->CR &= ~(DMA_SxCR_MINC);
+#elif defined DMA_CCR_EN
+      LCD_HANDLE.hdmatx->Instance->CCR &= ~(DMA_CCR_MINC);
+#endif
+    }
+
+    if(size==mode_16bit){
+      LCD_HANDLE.hdmatx->Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+      LCD_HANDLE.hdmatx->Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+#ifdef DMA_SxCR_EN
+      LCD_HANDLE.hdmatx->Instance->CR = (LCD_HANDLE.hdmatx->Instance->CR & ~(DMA_SxCR_PSIZE_Msk | DMA_SxCR_MSIZE_Msk)) |
+                                                   (1<<DMA_SxCR_PSIZE_Pos | 1<<DMA_SxCR_MSIZE_Pos);
+#elif defined DMA_CCR_EN
+      LCD_HANDLE.hdmatx->Instance->CCR = (LCD_HANDLE.hdmatx->Instance->CCR & ~(DMA_CCR_PSIZE_Msk | DMA_CCR_MSIZE_Msk)) |
+                                                   (1<<DMA_CCR_PSIZE_Pos | 1<<DMA_CCR_MSIZE_Pos);
+#endif
+
+    }
+    else{
+      LCD_HANDLE.hdmatx->Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+      LCD_HANDLE.hdmatx->Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+#ifdef DMA_SxCR_EN
+      LCD_HANDLE.hdmatx->Instance->CR = (LCD_HANDLE.hdmatx->Instance->CR & ~(DMA_SxCR_PSIZE_Msk | DMA_SxCR_MSIZE_Msk));
+#elif defined DMA_CCR_EN
+      LCD_HANDLE.hdmatx->Instance->CCR = (LCD_HANDLE.hdmatx->Instance->CCR & ~(DMA_CCR_PSIZE_Msk | DMA_CCR_MSIZE_Msk));
+#endif
+    }
+  }
+}
+#endif
+
+static void SPI_Begin(void)
+{
+#ifdef LCD_CS
+  LCD_PIN(LCD_CS,RESET);
+#endif
+}
+
+static void SPI_End(void)
+{
+#ifdef LCD_CS
+  LCD_PIN(LCD_CS,SET);
+#endif
+}
+
+/**
+ * @brief Send command and arguments
+ * @param cmd -> command to write
+ * @param args -> arguments
+ * @param argc -> argument count
+ * @return none
+ */
+static void SPI_Command(uint8_t cmd, const uint8_t *args, uint8_t argc)
+{
+  setSPI_Size(mode_8bit);
+  lcd_bus_bytes += 1+argc;
+  LCD_PIN(LCD_DC,RESET);
+  HAL_SPI_Transmit(&LCD_HANDLE, &cmd, 1, HAL_MAX_DELAY);
+  LCD_PIN(LCD_DC,SET);
+  if(argc){
+    HAL_SPI_Transmit(&LCD_HANDLE, (uint8_t*)args, argc, HAL_MAX_DELAY);
+  }
+}
+
+/**
+ * @brief Write pixels using polled transfers
+ * @param pixels -> pixel data
+ * @param count -> pixel count
+ * @return none
+ */
+static void SPI_Write(const uint16_t *pixels, uint32_t count)
+{
+  setSPI_Size(mode_16bit);
+  lcd_bus_bytes += count*2;
+  LCD_PIN(LCD_DC,SET);
+  while(count){                                                                                     // split data in small chunks because HAL can't send more than 64K at once
+    uint16_t chunk = count > 65535 ? 65535 : count;
+    HAL_SPI_Transmit(&LCD_HANDLE, (uint8_t*)pixels, chunk, HAL_MAX_DELAY);
+    pixels += chunk;
+    count -= chunk;
+  }
+}
+
+/**
+ * @brief Repeat a pixel using polled transfers
+ * @param color -> pixel color
+ * @param count -> pixel count
+ * @return none
+ */
+static void SPI_Fill(uint16_t color, uint32_t count)
+{
+  uint16_t fill[DMA_Min_Pixels];                                                                  // Use a pixel buffer for faster filling, removes overhead.
+  UG_KernelFill16(fill, color, count<DMA_Min_Pixels ? count : DMA_Min_Pixels);                   // Fill the buffer with the color
+  while(count){
+    uint32_t sz = (count<DMA_Min_Pixels ? count : DMA_Min_Pixels);
+    SPI_Write(fill, sz);
+    count-=sz;
+  }
+}
+
+const lcd_transport_t lcd_spi_transport = {
+    .begin = SPI_Begin,
+    .end = SPI_End,
+    .command = SPI_Command,
+    .write = SPI_Write,
+    .fill = SPI_Fill,
+};
+
+#ifdef USE_DMA
+/**
+ * @brief Send pixels using DMA, waits until done
+ * @param src -> pixel data
+ * @param count -> pixel count
+ * @param memInc -> mem_fixed to repeat the first pixel
+ * @return none
+ */
+static void SPI_DMA_Send(const uint16_t *src, uint32_t count, uint8_t memInc)
+{
+  setDMAMemMode(memInc, mode_16bit);
+  lcd_bus_bytes += count*2;
+  LCD_PIN(LCD_DC,SET);
+  while(count){
+    uint16_t chunk = count > 65535 ? 65535 : count;
+    HAL_SPI_Transmit_DMA(&LCD_HANDLE, (uint8_t*)src, chunk);
+    while(HAL_DMA_GetState(LCD_HANDLE.hdmatx)!=HAL_DMA_STATE_READY);
+    if(memInc==mem_increase){
+      src += chunk;
+    }
+    count -= chunk;
+  }
+}
+
+static void SPI_DMA_Write(const uint16_t *pixels, uint32_t count)
+{
+  if(count>DMA_Min_Pixels)
+    SPI_DMA_Send(pixels, count, mem_increase);
+  else
+    SPI_Write(pixels, count);
+}
+
+static void SPI_DMA_Fill(uint16_t color, uint32_t count)
+{
+  if(count>DMA_Min_Pixels)
+    SPI_DMA_Send(&color, count, mem_fixed);
+  else
+    SPI_Fill(color, count);
+}
+
+#ifdef LCD_ASYNC_DMA
+/**
+ * @brief Start a DMA transfer and return, LCD_TransferDone() is called from the transfer complete interrupt
+ * @param pixels -> pixel data, must stay valid until done
+ * @param count -> pixel count
+ * @param fill -> repeat the first pixel
+ * @return none
+ */
+static void SPI_DMA_Start(const uint16_t *pixels, uint16_t count, uint8_t fill)
+{
+  setDMAMemMode(fill ? mem_fixed : mem_increase, mode_16bit);
+  lcd_bus_bytes += count*2;
+  LCD_PIN(LCD_DC,SET);
+  spi.async = 1;
+  HAL_SPI_Transmit_DMA(&LCD_HANDLE, (uint8_t*)pixels, count);
+}
+
+/**
+ * @brief Start a DMA transfer of command or argument bytes and return, LCD_TransferDone() is called from the transfer complete interrupt
+ * @param data -> bytes, must stay valid until the transfer is done
+ * @param count -> byte count
+ * @param dc -> D/C level, 0 for a command byte, 1 for its arguments
+ * @return none
+ */
+static void SPI_DMA_StartBytes(const uint8_t *data, uint16_t count, uint8_t dc)
+{
+  setDMAMemMode(mem_increase, mode_8bit);
+  lcd_bus_bytes += count;
+  LCD_PIN(LCD_DC,dc);
+  spi.async = 1;
+  HAL_SPI_Transmit_DMA(&LCD_HANDLE, (uint8_t*)data, count);
+}
+
+/**
+ * @brief SPI transfer complete handler, starts the next queued transfer.
+ *        Ignores other SPI handles and blocking transfers, so it can be called for every SPI interrupt.
+ * @param hspi -> SPI handle
+ * @return none
+ */
+void LCD_SPI_TxCplt(SPI_HandleTypeDef *hspi)
+{
+  if(hspi!=&LCD_HANDLE || !spi.async){
+    return;
+  }
+  spi.async = 0;
+  LCD_TransferDone();
+}
+
+#ifndef LCD_USER_SPI_CALLBACK
+/**
+ * @brief SPI transfer complete interrupt, overrides the weak HAL callback.
+ *        If the application needs this callback too, define LCD_USER_SPI_CALLBACK and call LCD_SPI_TxCplt() from its own.
+ * @param hspi -> SPI handle
+ * @return none
+ */
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  LCD_SPI_TxCplt(hspi);
+}
+#endif
+#endif
+
+const lcd_transport_t lcd_spi_dma_transport = {
+    .begin = SPI_Begin,
+    .end = SPI_End,
+    .command = SPI_Command,
+    .write = SPI_DMA_Write,
+    .fill = SPI_DMA_Fill,
+#ifdef LCD_ASYNC_DMA
+    .start = SPI_DMA_Start,
+    .start_bytes = SPI_DMA_StartBytes,
+#endif
+};
+#endif
+#endif // LCD_FSMC
@@ -0,0 +1,32 @@
+#ifndef __LCD_TRANSPORT_H__
+#define __LCD_TRANSPORT_H__
+
+#include <stdint.h>
+
+/*
+ * Bus used to talk to the controller.
+ * lcd.c only calls these, so the same driver runs over SPI, SPI+DMA, a parallel bus or a host mock.
+ * Pixels are always RGB565 words, sent MSB first.
+ */
+typedef struct{
+  void (*begin)(void);                                              // Select the controller
+  void (*end)(void);                                                // Deselect the controller, after any blocking transfer is done
+  void (*command)(uint8_t cmd, const uint8_t *args, uint8_t argc);  // Command byte followed by its arguments
+  void (*write)(const uint16_t *pixels, uint32_t count);            // Pixel data, blocking
+  void (*fill)(uint16_t color, uint32_t count);                     // Same pixel repeated, blocking
+  void (*start)(const uint16_t *pixels, uint16_t count, uint8_t fill);  // Start a transfer and return, LCD_TransferDone() must be called when done.
+                                                                    // fill: repeat the first pixel. NULL if not supported
+  void (*start_bytes)(const uint8_t *data, uint16_t count, uint8_t dc);  // Start a command (dc 0) or argument (dc 1) byte transfer and return,
+                                                                    // LCD_TransferDone() must be called when done. Needed if start is set
+}lcd_transport_t;
+
+extern volatile uint32_t lcd_bus_bytes;                             // Bytes sent so far, commands and data. Every transport adds what it sends
+
+extern const lcd_transport_t lcd_spi_transport;
+extern const lcd_transport_t lcd_spi_dma_transport;
+extern const lcd_transport_t lcd_fsmc_transport;
+
+void LCD_SetTransport(const lcd_transport_t *transport);
+void LCD_TransferDone(void);
+
+#endif // __LCD_TRANSPORT_H__
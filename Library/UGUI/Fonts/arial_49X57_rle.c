@@ -0,0 +1,259 @@
+// Run length encoded by ugui_font_rle
+
+/************************************************
+Add this lines to ugui.h:
+  #ifdef USE_FONT_arial_49X57_RLE
+  extern UG_FONT FONT_arial_49X57_RLE[];
+  #endif
+
+To enable this font, add this line to ugui_config.h:
+  #define UGUI_USE_FONT_arial_49X57_RLE
+************************************************/
+
+#include "ugui.h"
+#ifdef UGUI_USE_FONT_arial_49X57_RLE
+
+UG_FONT FONT_arial_49X57_RLE[] = {
+  // Width, Height, Chars, Offsets size, Bytes per char, Flags
+  0x31,0x39,0x00,0xBE,0x00,0x0B,0x00,0x00,0x60,
+  // Widths
+  0x0E,0x10,0x12,0x1C,0x1C,0x2C,0x21,0x0A,0x11,0x11,
+  0x13,0x1D,0x0E,0x11,0x0E,0x0E,0x1C,0x1C,0x1C,0x1C,
+  0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x0E,0x0E,0x1D,0x1D,
+  0x1D,0x1C,0x33,0x21,0x21,0x24,0x24,0x21,0x1F,0x27,
+  0x24,0x0E,0x19,0x21,0x1C,0x29,0x24,0x27,0x21,0x27,
+  0x24,0x21,0x1F,0x24,0x21,0x32,0x21,0x21,0x1F,0x0E,
+  0x0E,0x0E,0x16,0x1C,0x11,0x1C,0x1C,0x19,0x1C,0x1C,
+  0x0E,0x1C,0x1C,0x0C,0x0A,0x19,0x0C,0x28,0x1C,0x1C,
+  0x1C,0x1C,0x11,0x19,0x0E,0x1C,0x19,0x23,0x18,0x19,
+  0x19,0x11,0x0C,0x11,0x1D,0x10,0x1C,0x1C,0x1C,0x1C,
+  0x0C,0x1C,0x11,0x25,0x13,0x1C,0x1D,0x11,0x25,0x1C,
+  0x14,0x1B,0x11,0x11,0x11,0x1D,0x1B,0x0E,0x11,0x11,
+  0x12,0x1C,0x2A,0x2A,0x2A,0x1F,0x21,0x21,0x21,0x21,
+  0x21,0x21,0x32,0x24,0x21,0x21,0x21,0x21,0x0E,0x0E,
+  0x0E,0x0E,0x24,0x24,0x27,0x27,0x27,0x27,0x27,0x1D,
+  0x27,0x24,0x24,0x24,0x24,0x21,0x21,0x1F,0x1C,0x1C,
+  0x1C,0x1C,0x1C,0x1C,0x2C,0x19,0x1C,0x1C,0x1C,0x1C,
+  0x0E,0x0E,0x0E,0x0E,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,
+  0x1C,0x1B,0x1F,0x1C,0x1C,0x1C,0x1C,0x19,0x1C,0x19,
+  // Offsets
+  0x01,0x00,0x20,0x00,0x7E,0x01,0x00,0xA1,0x00,0xFF,0xFF,
+  // Glyph offsets
+  0x00,0x00,0x00,0x36,0x00,0x73,0x00,0xC2,0x01,0x33,0x01,0xB5,0x02,0x78,0x02,0xFD,
+  0x03,0x27,0x03,0x63,0x03,0x9E,0x03,0xEC,0x04,0x5B,0x04,0x92,0x04,0xD2,0x05,0x08,
+  0x05,0x40,0x05,0xBC,0x06,0x2D,0x06,0x9D,0x07,0x0D,0x07,0x80,0x07,0xF0,0x08,0x65,
+  0x08,0xD5,0x09,0x48,0x09,0xBB,0x09,0xF1,0x0A,0x28,0x0A,0x99,0x0B,0x07,0x0B,0x78,
+  0x0B,0xEA,0x0C,0xB9,0x0D,0x44,0x0D,0xC1,0x0E,0x54,0x0E,0xE8,0x0F,0x5F,0x0F,0xD3,
+  0x10,0x6B,0x11,0x06,0x11,0x3E,0x11,0xA7,0x12,0x2C,0x12,0x9B,0x13,0x59,0x13,0xEC,
+  0x14,0x86,0x15,0x02,0x15,0xA2,0x16,0x2F,0x16,0xAA,0x17,0x1D,0x17,0xB7,0x18,0x3F,
+  0x19,0x18,0x19,0x9B,0x1A,0x1A,0x1A,0x8E,0x1A,0xC7,0x1A,0xFF,0x1B,0x38,0x1B,0x95,
+  0x1C,0x00,0x1C,0x40,0x1C,0xAF,0x1D,0x1F,0x1D,0x83,0x1D,0xF3,0x1E,0x62,0x1E,0x9A,
+  0x1F,0x0B,0x1F,0x7A,0x1F,0xAF,0x1F,0xE4,0x20,0x4D,0x20,0x83,0x21,0x25,0x21,0x94,
+  0x22,0x09,0x22,0x79,0x22,0xEA,0x23,0x2C,0x23,0x8A,0x23,0xC2,0x24,0x31,0x24,0x9B,
+  0x25,0x3B,0x25,0x9F,0x26,0x0A,0x26,0x73,0x26,0xAE,0x26,0xE6,0x27,0x21,0x27,0x92,
+  0x27,0xCE,0x28,0x48,0x28,0xB9,0x29,0x2D,0x29,0xA0,0x29,0xD6,0x2A,0x43,0x2A,0x87,
+  0x2B,0x29,0x2B,0x78,0x2B,0xE9,0x2C,0x58,0x2C,0x98,0x2D,0x3A,0x2D,0xA5,0x2D,0xF5,
+  0x2E,0x60,0x2E,0xA1,0x2E,0xE6,0x2F,0x26,0x2F,0x9A,0x30,0x0A,0x30,0x40,0x30,0x80,
+  0x30,0xC2,0x31,0x10,0x31,0x81,0x32,0x2D,0x32,0xDA,0x33,0x89,0x33,0xFE,0x34,0x89,
+  0x35,0x14,0x35,0xA2,0x36,0x30,0x36,0xBF,0x37,0x4E,0x38,0x14,0x38,0xA9,0x39,0x1F,
+  0x39,0x95,0x3A,0x0E,0x3A,0x88,0x3A,0xC1,0x3A,0xFA,0x3B,0x37,0x3B,0x73,0x3C,0x08,
+  0x3C,0x9D,0x3D,0x39,0x3D,0xD6,0x3E,0x74,0x3F,0x0F,0x3F,0xAB,0x40,0x1D,0x40,0xB4,
+  0x41,0x51,0x41,0xEC,0x42,0x89,0x43,0x25,0x43,0xA4,0x44,0x25,0x44,0xA0,0x45,0x0F,
+  0x45,0x7F,0x45,0xF3,0x46,0x61,0x46,0xD3,0x47,0x47,0x47,0xEE,0x48,0x54,0x48,0xC3,
+  0x49,0x33,0x49,0xA7,0x4A,0x19,0x4A,0x51,0x4A,0x89,0x4A,0xC5,0x4B,0x01,0x4B,0x79,
+  0x4B,0xE7,0x4C,0x5C,0x4C,0xD2,0x4D,0x4C,0x4D,0xC0,0x4E,0x38,0x4E,0xA2,0x4F,0x24,
+  0x4F,0x94,0x50,0x04,0x50,0x78,0x50,0xEB,0x51,0x58,0x51,0xC9,
+  // Glyphs
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0x20    32    ' '
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x14,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xD2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xF0,0xF0,0xF0,0xF0,0xF0,0x24,0xC4,0xC4,0xC4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x20, // 0x21    33    '!'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x24,0x64,0x44,0x64,0x44,0x64,0x44,0x64,0x44,0x64,0x44,0x64,0x44,0x64,0x44,0x64,0x44,0x64,0x44,0x64,0x52,0x82,0x62,0x82,0x62,0x82,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0, // 0x22    34    '"'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x54,0x74,0xD4,0x74,0xC5,0x64,0xD4,0x74,0xD4,0x74,0xD4,0x74,0xD4,0x65,0xC4,0x74,0xD4,0x74,0xD4,0x74,0x5F,0x0C,0x1F,0x0C,0x1F,0x0C,0x1F,0x0C,0x84,0x74,0xD4,0x65,0xC4,0x74,0xD4,0x74,0xD4,0x74,0xD4,0x74,0xC5,0x64,0xD4,0x74,0x8F,0x0C,0x1F,0x0C,0x1F,0x0C,0x1F,0x0C,0x54,0x74,0xD4,0x74,0xD4,0x74,0xC5,0x64,0xD4,0x74,0xD4,0x74,0xD4,0x74,0xD4,0x65,0xC4,0x74,0xD4,0x74,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x40, // 0x23    35    '#'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC3,0xF0,0xA3,0xF0,0x78,0xF0,0x2E,0xDF,0x01,0xBF,0x03,0x97,0x23,0x17,0x85,0x43,0x35,0x75,0x53,0x44,0x74,0x63,0x45,0x64,0x63,0x54,0x64,0x63,0x52,0x84,0x63,0xF4,0x63,0xF5,0x53,0xF0,0x15,0x43,0xF0,0x17,0x23,0xF0,0x2B,0xF0,0x3E,0xF0,0x1E,0xF0,0x2C,0xF0,0x3B,0xF0,0x23,0x27,0xF0,0x13,0x45,0xF0,0x13,0x55,0xF3,0x64,0x62,0x73,0x64,0x44,0x73,0x64,0x45,0x63,0x64,0x45,0x63,0x64,0x54,0x63,0x55,0x55,0x53,0x54,0x75,0x43,0x45,0x77,0x23,0x26,0x9F,0x04,0xAF,0x02,0xCE,0xF0,0x29,0xF0,0x73,0xF0,0xA3,0xF0,0xA3,0xF0,0xA3,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD0, // 0x24    36    '$'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD5,0xF0,0x24,0xF0,0x19,0xE5,0xFB,0xD4,0xF5,0x35,0xB5,0xF4,0x54,0xB4,0xF0,0x13,0x64,0xA5,0xF4,0x74,0x94,0xF0,0x14,0x74,0x85,0xF0,0x14,0x74,0x84,0xF0,0x24,0x74,0x74,0xF0,0x34,0x74,0x65,0xF0,0x34,0x74,0x64,0xF0,0x44,0x74,0x55,0xF0,0x53,0x64,0x64,0xF0,0x64,0x54,0x55,0xF0,0x65,0x35,0x54,0xF0,0x8B,0x55,0xF0,0x99,0x64,0x65,0xF0,0x15,0x75,0x49,0xF0,0xB4,0x4B,0xF0,0x94,0x45,0x35,0xF0,0x75,0x44,0x54,0xF0,0x74,0x53,0x64,0xF0,0x65,0x44,0x74,0xF0,0x54,0x54,0x74,0xF0,0x45,0x54,0x74,0xF0,0x44,0x64,0x74,0xF0,0x35,0x64,0x74,0xF0,0x34,0x74,0x74,0xF0,0x25,0x74,0x74,0xF0,0x24,0x93,0x64,0xF0,0x24,0xA4,0x54,0xF0,0x15,0xA5,0x35,0xF0,0x14,0xCB,0xF0,0x15,0xD9,0xF0,0x24,0xF0,0x15,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC0, // 0x25    37    '%'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC7,0xF0,0x9B,0xF0,0x5E,0xF0,0x3F,0x01,0xF0,0x26,0x46,0xF0,0x15,0x85,0xF4,0xA4,0xF4,0xA4,0xF4,0xA4,0xF4,0xA4,0xF0,0x14,0x84,0xF0,0x25,0x65,0xF0,0x35,0x45,0xF0,0x55,0x16,0xF0,0x7A,0xF0,0x97,0xF0,0x97,0xF0,0x9A,0xF0,0x7C,0xF0,0x56,0x35,0xF0,0x35,0x65,0x64,0x65,0x84,0x55,0x64,0x95,0x44,0x65,0xA5,0x25,0x64,0xCA,0x74,0xD9,0x74,0xE7,0x84,0xE6,0x95,0xE6,0x95,0xC8,0x86,0x9B,0x86,0x6E,0x8F,0x03,0x27,0x7F,0x01,0x45,0x9D,0x73,0xD8,0xA1,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x70, // 0x26    38    '&'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC4,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x72,0x82,0x82,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0, // 0x27    39    '''
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x13,0xD3,0xD4,0xD3,0xD4,0xD3,0xD4,0xD3,0xD4,0xD3,0xD4,0xD4,0xD3,0xD4,0xD4,0xD4,0xD4,0xC4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xE4,0xD4,0xD4,0xD4,0xE3,0xE4,0xD4,0xE3,0xE4,0xE3,0xE4,0xE3,0xE4,0xE3,0xE4,0xE3,0xF3,0xF0,0x50, // 0x28    40    '('
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x83,0xF3,0xE4,0xE3,0xE4,0xE3,0xE4,0xE3,0xE4,0xE3,0xE4,0xD4,0xE3,0xE4,0xD4,0xD4,0xD4,0xE4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xC4,0xD4,0xD4,0xD4,0xD3,0xD4,0xD4,0xD3,0xD4,0xD3,0xD4,0xD3,0xD4,0xD3,0xD4,0xD3,0xD3,0xF0,0xD0, // 0x29    41    ')'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x44,0xF4,0xF4,0xF4,0x93,0x34,0x33,0x39,0x16,0x2F,0x02,0x4E,0x95,0xD8,0xA4,0x15,0x85,0x25,0x74,0x45,0x64,0x44,0x91,0x61,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC0, // 0x2A    42    '*'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xFF,0x09,0x5F,0x09,0x5F,0x09,0x5F,0x09,0xF4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB0, // 0x2B    43    '+'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x74,0xA4,0xA4,0xA4,0xC2,0xC2,0xC2,0xC2,0xB2,0xC2,0xB3,0xC1,0xF0,0xF0,0xF0,0x50, // 0x2C    44    ','
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x4E,0x3E,0x3E,0x3E,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0, // 0x2D    45    '-'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x74,0xA4,0xA4,0xA4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA0, // 0x2E    46    '.'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF4,0xA4,0x94,0xA4,0xA4,0x95,0x94,0xA4,0xA4,0x94,0xA4,0xA4,0xA4,0x94,0xA4,0xA4,0x95,0x94,0xA4,0xA4,0x94,0xA4,0xA4,0x95,0x94,0xA4,0xA4,0x94,0xA4,0xA4,0xA4,0x94,0xA4,0xA4,0x95,0x94,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE0, // 0x2F    47    '/'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x58,0xF0,0x3C,0xEF,0x01,0xCF,0x02,0xA6,0x66,0x95,0xA5,0x84,0xC4,0x75,0xC4,0x74,0xE4,0x64,0xE4,0x64,0xE4,0x55,0xF4,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x54,0xE4,0x64,0xE4,0x64,0xE4,0x65,0xC5,0x74,0xC4,0x85,0xA5,0x96,0x66,0xAF,0x03,0xBF,0x01,0xEC,0xF0,0x38,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0x30    48    '0'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA3,0xF0,0x94,0xF0,0x94,0xF0,0x85,0xF0,0x76,0xF0,0x67,0xF0,0x49,0xF0,0x3A,0xF0,0x17,0x14,0xF7,0x24,0xF6,0x34,0xF4,0x54,0xF2,0x74,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0x31    49    '1'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x58,0xF0,0x2D,0xEF,0x01,0xBF,0x03,0x96,0x76,0x86,0xA5,0x74,0xD4,0x65,0xD5,0x54,0xF4,0x54,0xF4,0x72,0xF4,0xF0,0x94,0xF0,0x94,0xF0,0x84,0xF0,0x94,0xF0,0x85,0xF0,0x75,0xF0,0x75,0xF0,0x75,0xF0,0x76,0xF0,0x65,0xF0,0x75,0xF0,0x75,0xF0,0x75,0xF0,0x75,0xF0,0x66,0xF0,0x66,0xF0,0x66,0xF0,0x65,0xF0,0x75,0xF0,0x75,0xF0,0x75,0xF0,0x8F,0x08,0x4F,0x09,0x4F,0x09,0x4F,0x09,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB0, // 0x32    50    '2'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x48,0xF0,0x3C,0xFF,0xCF,0x02,0xA6,0x67,0x85,0xA5,0x84,0xC5,0x65,0xD4,0x64,0xE4,0x82,0xE4,0xF0,0x94,0xF0,0x94,0xF0,0x84,0xF0,0x85,0xF0,0x66,0xF0,0x2A,0xF0,0x38,0xF0,0x5B,0xF0,0x2C,0xF0,0x86,0xF0,0x95,0xF0,0x94,0xF0,0x95,0xF0,0x94,0xF0,0x94,0x62,0xF0,0x14,0x44,0xF0,0x14,0x45,0xF4,0x45,0xE4,0x65,0xC5,0x66,0xA5,0x87,0x67,0x9F,0x03,0xBF,0x01,0xDD,0xF0,0x38,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0x33    51    '3'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE3,0xF0,0x94,0xF0,0x85,0xF0,0x76,0xF0,0x67,0xF0,0x67,0xF0,0x58,0xF0,0x49,0xF0,0x35,0x14,0xF0,0x34,0x24,0xF0,0x25,0x24,0xF0,0x15,0x34,0xF5,0x44,0xE5,0x54,0xE4,0x64,0xD5,0x64,0xC5,0x74,0xB5,0x84,0xB4,0x94,0xA5,0x94,0x95,0xA4,0x85,0xB4,0x75,0xC4,0x7F,0x0A,0x3F,0x0A,0x3F,0x0A,0x3F,0x0A,0xF0,0x54,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE0, // 0x34    52    '4'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x2F,0x02,0xBF,0x02,0xAF,0x03,0xAF,0x03,0xA4,0xF0,0x94,0xF0,0x94,0xF0,0x84,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x84,0xF0,0x94,0x37,0xE4,0x1C,0xBF,0x03,0xAF,0x04,0x87,0x86,0x76,0xA6,0x82,0xD5,0xF0,0x94,0xF0,0xA4,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0x44,0xF0,0x14,0x44,0xF4,0x55,0xE4,0x64,0xD5,0x65,0xB5,0x86,0x76,0xAF,0x02,0xCF,0xED,0xF0,0x37,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x40, // 0x35    53    '5'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x67,0xF0,0x3C,0xFF,0xBF,0x03,0xA6,0x66,0x95,0xA5,0x75,0xC4,0x75,0xC5,0x55,0xE4,0x54,0xF0,0x94,0xF0,0x94,0xF0,0x84,0xF0,0x94,0x67,0xB4,0x4B,0x94,0x2F,0x74,0x1F,0x02,0x69,0x77,0x57,0xB6,0x46,0xD5,0x45,0xF4,0x44,0xF0,0x24,0x34,0xF0,0x24,0x34,0xF0,0x24,0x34,0xF0,0x24,0x43,0xF0,0x24,0x43,0xF0,0x24,0x44,0xF5,0x44,0xF4,0x64,0xD5,0x65,0xB5,0x86,0x77,0x9F,0x03,0xBF,0x01,0xEC,0xF0,0x38,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0x36    54    '6'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xCF,0x08,0x5F,0x08,0x5F,0x08,0x5F,0x08,0xF0,0x93,0xF0,0x93,0xF0,0x93,0xF0,0x94,0xF0,0x84,0xF0,0x93,0xF0,0x94,0xF0,0x84,0xF0,0x93,0xF0,0x94,0xF0,0x84,0xF0,0x94,0xF0,0x84,0xF0,0x94,0xF0,0x84,0xF0,0x94,0xF0,0x94,0xF0,0x84,0xF0,0x94,0xF0,0x84,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x84,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x84,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA0, // 0x37    55    '7'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x58,0xF0,0x2D,0xEF,0x01,0xBF,0x03,0x97,0x67,0x85,0xA5,0x75,0xC5,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x65,0xC5,0x75,0xA5,0x96,0x76,0xAF,0x02,0xCE,0xDF,0xCF,0x03,0x96,0x77,0x76,0xA6,0x65,0xC5,0x55,0xE4,0x54,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x54,0xE4,0x64,0xD5,0x66,0xA6,0x77,0x76,0x9F,0x03,0xBF,0x01,0xDE,0xF0,0x28,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0x38    56    '8'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x57,0xF0,0x3C,0xFF,0xCF,0x02,0xA7,0x66,0x86,0xA5,0x75,0xC4,0x74,0xE4,0x55,0xE4,0x54,0xF0,0x13,0x54,0xF0,0x13,0x54,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF5,0x54,0xE5,0x55,0xC6,0x56,0xA7,0x67,0x69,0x7F,0x01,0x14,0x8E,0x24,0x9C,0x34,0xB7,0x64,0xF0,0x94,0xF0,0x84,0xF0,0x94,0xF0,0x94,0x64,0xD5,0x64,0xD4,0x84,0xB5,0x85,0x95,0x96,0x66,0xBF,0x02,0xCF,0xEC,0xF0,0x38,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x40, // 0x39    57    '9'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE4,0xA4,0xA4,0xA4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x74,0xA4,0xA4,0xA4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA0, // 0x3A    58    ':'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE4,0xA4,0xA4,0xA4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x74,0xA4,0xA4,0xA4,0xC2,0xC2,0xC2,0xC2,0xB2,0xC2,0xB3,0xC1,0xF0,0xF0,0xF0,0x50, // 0x3B    59    ';'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x81,0xF0,0xB3,0xF0,0x86,0xF0,0x68,0xF0,0x49,0xF0,0x29,0xF0,0x39,0xF0,0x38,0xF0,0x39,0xF0,0x38,0xF0,0x57,0xF0,0x74,0xF0,0xA7,0xF0,0x88,0xF0,0x89,0xF0,0x88,0xF0,0x89,0xF0,0x79,0xF0,0x89,0xF0,0x78,0xF0,0x86,0xF0,0xB3,0xF0,0xD1,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x10, // 0x3C    60    '<'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xCF,0x08,0x6F,0x08,0x6F,0x08,0x6F,0x08,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xEF,0x08,0x6F,0x08,0x6F,0x08,0x6F,0x08,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC0, // 0x3D    61    '='
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x11,0xF0,0xD3,0xF0,0xB6,0xF0,0x88,0xF0,0x79,0xF0,0x89,0xF0,0x79,0xF0,0x88,0xF0,0x89,0xF0,0x88,0xF0,0x87,0xF0,0xA4,0xF0,0x77,0xF0,0x58,0xF0,0x39,0xF0,0x38,0xF0,0x39,0xF0,0x39,0xF0,0x29,0xF0,0x48,0xF0,0x66,0xF0,0x83,0xF0,0xB1,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x80, // 0x3E    62    '>'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x58,0xF0,0x2E,0xDF,0x01,0xBF,0x03,0x97,0x67,0x76,0xA6,0x65,0xC5,0x64,0xE5,0x45,0xF4,0x44,0xF0,0x14,0x62,0xF0,0x14,0xF0,0x94,0xF0,0x85,0xF0,0x84,0xF0,0x85,0xF0,0x75,0xF0,0x75,0xF0,0x66,0xF0,0x66,0xF0,0x66,0xF0,0x75,0xF0,0x75,0xF0,0x84,0xF0,0x85,0xF0,0x84,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x14,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x50, // 0x3F    63    '?'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x7A,0xF0,0xF0,0x7F,0x03,0xF0,0xF0,0x1F,0x07,0xF0,0xCF,0x0B,0xF0,0x8A,0x9A,0xF0,0x68,0xF0,0x17,0xF0,0x47,0xF0,0x56,0xF0,0x26,0xF0,0x86,0xF6,0xF0,0xA6,0xE5,0xA6,0xB6,0xC5,0x99,0x44,0x35,0xB5,0x8D,0x24,0x45,0xA4,0x8F,0x05,0x45,0x95,0x76,0x59,0x64,0x94,0x76,0x87,0x65,0x84,0x75,0xA6,0x74,0x74,0x75,0xB6,0x74,0x74,0x74,0xD5,0x74,0x74,0x65,0xD4,0x84,0x74,0x64,0xE4,0x84,0x64,0x74,0xE4,0x84,0x64,0x65,0xE4,0x84,0x64,0x64,0xF4,0x84,0x64,0x64,0xE4,0x84,0x74,0x64,0xE4,0x84,0x74,0x64,0xE4,0x84,0x74,0x64,0xD5,0x74,0x84,0x64,0xD4,0x75,0x84,0x65,0xB5,0x74,0x94,0x74,0xA6,0x65,0xA4,0x65,0x87,0x55,0xB4,0x75,0x59,0x36,0xC4,0x7E,0x1C,0xD5,0x7C,0x2B,0xF4,0x8A,0x49,0xF0,0x15,0x96,0x76,0xF0,0x45,0xF0,0xF0,0x44,0x86,0xF0,0xF0,0x24,0xA6,0xF0,0xF4,0xC6,0xF0,0xC6,0xD7,0xF0,0x87,0xF8,0xF0,0x47,0xF0,0x3B,0xC9,0xF0,0x6F,0x0E,0xF0,0x9F,0x0A,0xF0,0xDF,0x05,0xF0,0xF0,0x5D,0xF0,0x20, // 0x40    64    '@'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE5,0xF0,0xC7,0xF0,0xB7,0xF0,0xA9,0xF0,0x94,0x14,0xF0,0x94,0x14,0xF0,0x85,0x15,0xF0,0x74,0x34,0xF0,0x65,0x35,0xF0,0x55,0x35,0xF0,0x54,0x54,0xF0,0x45,0x55,0xF0,0x34,0x74,0xF0,0x25,0x74,0xF0,0x25,0x75,0xF0,0x14,0x94,0xF5,0x95,0xE5,0x95,0xE4,0xB4,0xD5,0xB5,0xC5,0xB5,0xBF,0x08,0xAF,0x08,0xAF,0x08,0x9F,0x0A,0x85,0xF5,0x75,0xF0,0x25,0x65,0xF0,0x25,0x65,0xF0,0x25,0x55,0xF0,0x45,0x45,0xF0,0x45,0x36,0xF0,0x45,0x35,0xF0,0x65,0x25,0xF0,0x65,0x16,0xF0,0x6B,0xF0,0x85,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0x41    65    'A'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x4F,0x03,0xFF,0x06,0xCF,0x07,0xBF,0x08,0xA5,0xC7,0x95,0xD6,0x95,0xE6,0x85,0xF5,0x85,0xF5,0x85,0xF5,0x85,0xF5,0x85,0xF5,0x85,0xE5,0x95,0xD6,0x95,0xC6,0xAF,0x07,0xBF,0x06,0xCF,0x06,0xCF,0x08,0xA5,0xC7,0x95,0xE6,0x85,0xF5,0x85,0xF0,0x14,0x85,0xF0,0x15,0x75,0xF0,0x15,0x75,0xF0,0x15,0x75,0xF0,0x15,0x75,0xF0,0x15,0x75,0xF6,0x75,0xF5,0x85,0xE6,0x85,0xC7,0x9F,0x09,0x9F,0x08,0xAF,0x06,0xCF,0x03,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE0, // 0x42    66    'B'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x98,0xF0,0xAD,0xF0,0x6F,0x02,0xF0,0x3F,0x04,0xF0,0x17,0x68,0xE6,0xA7,0xC6,0xC6,0xC5,0xE6,0xA5,0xF0,0x15,0xA5,0xF0,0x16,0x85,0xF0,0x35,0x85,0xF0,0x31,0xC5,0xF0,0xF6,0xF0,0xF5,0xF0,0xF0,0x15,0xF0,0xF0,0x15,0xF0,0xF0,0x15,0xF0,0xF0,0x15,0xF0,0xF0,0x15,0xF0,0xF0,0x15,0xF0,0xF0,0x15,0xF0,0xF0,0x15,0xF0,0xF0,0x15,0xF0,0xF0,0x25,0xF0,0xF0,0x15,0xF0,0x44,0x85,0xF0,0x36,0x75,0xF0,0x36,0x85,0xF0,0x25,0x95,0xF0,0x16,0xA5,0xF5,0xB6,0xD6,0xC6,0xB6,0xE7,0x68,0xF0,0x1F,0x04,0xF0,0x3F,0x02,0xF0,0x6D,0xF0,0xA9,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD0, // 0x43    67    'C'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x4F,0x03,0xF0,0x3F,0x06,0xFF,0x08,0xDF,0x09,0xC5,0xC8,0xB5,0xE7,0xA5,0xF6,0xA5,0xF0,0x16,0x95,0xF0,0x25,0x95,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x45,0x75,0xF0,0x45,0x75,0xF0,0x45,0x75,0xF0,0x45,0x75,0xF0,0x45,0x75,0xF0,0x45,0x75,0xF0,0x45,0x75,0xF0,0x45,0x75,0xF0,0x45,0x75,0xF0,0x45,0x75,0xF0,0x45,0x75,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x26,0x85,0xF0,0x25,0x95,0xF0,0x16,0x95,0xF0,0x15,0xA5,0xE7,0xA5,0xC8,0xBF,0x09,0xCF,0x08,0xDF,0x06,0xFF,0x03,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x50, // 0x44    68    'D'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x4F,0x0A,0x8F,0x0A,0x8F,0x0A,0x8F,0x0A,0x85,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xDF,0x09,0x9F,0x09,0x9F,0x09,0x9F,0x09,0x95,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xDF,0x0B,0x7F,0x0B,0x7F,0x0B,0x7F,0x0B,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x60, // 0x45    69    'E'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xEF,0x09,0x7F,0x09,0x7F,0x09,0x7F,0x09,0x75,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xBF,0x06,0xAF,0x06,0xAF,0x06,0xAF,0x06,0xA5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0x46    70    'F'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x79,0xF0,0xCF,0xF0,0x7F,0x04,0xF0,0x4F,0x06,0xF0,0x19,0x78,0xE7,0xC7,0xD6,0xF6,0xB6,0xF0,0x25,0xA6,0xF0,0x36,0x95,0xF0,0x55,0x95,0xF0,0x55,0x85,0xF0,0x72,0xA5,0xF0,0xF0,0x45,0xF0,0xF0,0x35,0xF0,0xF0,0x45,0xF0,0xF0,0x45,0xF0,0xF0,0x45,0xF0,0xF0,0x45,0xF0,0xF0,0x45,0xDF,0x65,0xDF,0x65,0xDF,0x65,0xDF,0x65,0xF0,0x85,0x75,0xF0,0x75,0x75,0xF0,0x75,0x75,0xF0,0x75,0x85,0xF0,0x65,0x85,0xF0,0x65,0x86,0xF0,0x55,0x96,0xF0,0x36,0xA6,0xF0,0x17,0xB7,0xC9,0xC8,0x7A,0xFF,0x08,0xF0,0x2F,0x05,0xF0,0x6F,0x01,0xF0,0xBA,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD0, // 0x47    71    'G'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x45,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x8F,0x0D,0x8F,0x0D,0x8F,0x0D,0x8F,0x0D,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA0, // 0x48    72    'H'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA5,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x80, // 0x49    73    'I'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB5,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0xF0,0x55,0x65,0x95,0x65,0x95,0x65,0x95,0x65,0x95,0x66,0x75,0x85,0x75,0x86,0x56,0x9F,0xAE,0xDB,0xF0,0x17,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x50, // 0x4A    74    'J'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x45,0xF0,0x27,0x45,0xF0,0x17,0x55,0xF7,0x65,0xE7,0x75,0xD7,0x85,0xC7,0x95,0xB7,0xA5,0xA7,0xB5,0x97,0xC5,0x87,0xD5,0x77,0xE5,0x67,0xF5,0x57,0xF0,0x15,0x47,0xF0,0x25,0x37,0xF0,0x35,0x27,0xF0,0x45,0x19,0xF0,0x3F,0x01,0xF0,0x2F,0x02,0xF0,0x1A,0x16,0xF0,0x19,0x36,0xF8,0x56,0xE7,0x76,0xD6,0x86,0xD5,0xA6,0xC5,0xB6,0xB5,0xC6,0xA5,0xC6,0xA5,0xD6,0x95,0xE6,0x85,0xF6,0x75,0xF7,0x65,0xF0,0x16,0x65,0xF0,0x26,0x55,0xF0,0x36,0x45,0xF0,0x45,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0x4B    75    'K'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE5,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x85,0xF0,0x8F,0x07,0x6F,0x07,0x6F,0x07,0x6F,0x07,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA0, // 0x4C    76    'L'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x88,0xF0,0x48,0x68,0xF0,0x39,0x69,0xF0,0x29,0x69,0xF0,0x29,0x69,0xF0,0x29,0x6A,0xFA,0x65,0x14,0xF4,0x15,0x65,0x14,0xF4,0x15,0x65,0x15,0xD5,0x15,0x65,0x24,0xD4,0x25,0x65,0x24,0xD4,0x25,0x65,0x25,0xB5,0x25,0x65,0x34,0xB4,0x35,0x65,0x34,0xB4,0x35,0x65,0x35,0x95,0x35,0x65,0x44,0x94,0x45,0x65,0x44,0x94,0x45,0x65,0x45,0x75,0x45,0x65,0x54,0x74,0x55,0x65,0x54,0x74,0x55,0x65,0x55,0x55,0x55,0x65,0x64,0x54,0x65,0x65,0x64,0x54,0x65,0x65,0x65,0x35,0x65,0x65,0x65,0x35,0x65,0x65,0x74,0x34,0x75,0x65,0x74,0x34,0x75,0x65,0x75,0x15,0x75,0x65,0x84,0x14,0x85,0x65,0x84,0x14,0x85,0x65,0x84,0x14,0x85,0x65,0x97,0x95,0x65,0x97,0x95,0x65,0x97,0x95,0x65,0xA5,0xA5,0x65,0xA5,0xA5,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x40, // 0x4D    77    'M'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x46,0xF0,0x25,0x86,0xF0,0x25,0x87,0xF0,0x15,0x88,0xF5,0x88,0xF5,0x89,0xE5,0x8A,0xD5,0x8A,0xD5,0x8B,0xC5,0x85,0x15,0xC5,0x85,0x16,0xB5,0x85,0x26,0xA5,0x85,0x26,0xA5,0x85,0x36,0x95,0x85,0x46,0x85,0x85,0x46,0x85,0x85,0x56,0x75,0x85,0x66,0x65,0x85,0x66,0x65,0x85,0x76,0x55,0x85,0x86,0x45,0x85,0x86,0x45,0x85,0x96,0x35,0x85,0xA6,0x25,0x85,0xA6,0x25,0x85,0xB6,0x15,0x85,0xC5,0x15,0x85,0xCB,0x85,0xDA,0x85,0xDA,0x85,0xE9,0x85,0xF8,0x85,0xF8,0x85,0xF0,0x17,0x85,0xF0,0x26,0x85,0xF0,0x26,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA0, // 0x4E    78    'N'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x69,0xF0,0xCE,0xF0,0x9F,0x02,0xF0,0x5F,0x06,0xF0,0x28,0x78,0xF7,0xB7,0xE6,0xD6,0xD6,0xF6,0xB6,0xF0,0x26,0xA5,0xF0,0x45,0x95,0xF0,0x56,0x85,0xF0,0x65,0x85,0xF0,0x65,0x85,0xF0,0x65,0x75,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x75,0xF0,0x65,0x85,0xF0,0x65,0x85,0xF0,0x65,0x86,0xF0,0x46,0x95,0xF0,0x45,0xA6,0xF0,0x26,0xB6,0xF6,0xD6,0xD6,0xE7,0xB7,0xF8,0x78,0xF0,0x2F,0x06,0xF0,0x5F,0x02,0xF0,0x9D,0xF0,0xD8,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x10, // 0x4F    79    'O'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x4F,0x04,0xEF,0x06,0xCF,0x08,0xAF,0x09,0x95,0xD6,0x95,0xE6,0x85,0xF5,0x85,0xF6,0x75,0xF0,0x15,0x75,0xF0,0x15,0x75,0xF0,0x15,0x75,0xF0,0x15,0x75,0xF0,0x15,0x75,0xF6,0x75,0xF5,0x85,0xE6,0x85,0xC7,0x9F,0x09,0x9F,0x08,0xAF,0x06,0xCF,0x04,0xE5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC0, // 0x50    80    'P'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x68,0xF0,0xDE,0xF0,0x8F,0x02,0xF0,0x6F,0x05,0xF0,0x38,0x68,0xF0,0x17,0xA7,0xE6,0xE6,0xD5,0xF0,0x15,0xC6,0xF0,0x16,0xB5,0xF0,0x35,0xA6,0xF0,0x36,0x95,0xF0,0x55,0x95,0xF0,0x55,0x95,0xF0,0x55,0x85,0xF0,0x75,0x75,0xF0,0x75,0x75,0xF0,0x75,0x75,0xF0,0x75,0x75,0xF0,0x75,0x75,0xF0,0x75,0x75,0xF0,0x75,0x75,0xF0,0x75,0x75,0xF0,0x75,0x75,0xF0,0x75,0x85,0xF0,0x55,0x95,0xF0,0x55,0x95,0xF0,0x55,0x96,0xF0,0x45,0xA5,0xA3,0x55,0xB6,0x94,0x45,0xC5,0x86,0x25,0xD6,0x9A,0xF7,0x98,0xF0,0x18,0x77,0xF0,0x3F,0x07,0xF0,0x3F,0x08,0xF0,0x3E,0x27,0xF0,0x48,0x67,0xF0,0xF0,0x44,0xF0,0xF0,0x72,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x10, // 0x51    81    'Q'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x4F,0x06,0xFF,0x09,0xCF,0x0A,0xBF,0x0B,0xA5,0xE8,0x95,0xF0,0x16,0x95,0xF0,0x25,0x95,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x26,0x85,0xF0,0x25,0x95,0xF0,0x16,0x95,0xE7,0xAF,0x0B,0xAF,0x0A,0xBF,0x08,0xDF,0x06,0xF5,0x95,0xF0,0x25,0xA6,0xF5,0xB6,0xE5,0xC6,0xD5,0xD6,0xC5,0xD6,0xC5,0xE6,0xB5,0xF6,0xA5,0xF6,0xA5,0xF0,0x16,0x95,0xF0,0x25,0x95,0xF0,0x26,0x85,0xF0,0x36,0x75,0xF0,0x45,0x75,0xF0,0x46,0x65,0xF0,0x55,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x80, // 0x52    82    'R'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x98,0xF0,0x7E,0xF0,0x3F,0x02,0xFF,0x04,0xD7,0x77,0xB6,0xA6,0xB5,0xC6,0x95,0xE5,0x95,0xE6,0x85,0xF5,0x85,0xF5,0x85,0xF0,0xD6,0xF0,0xD6,0xF0,0xC8,0xF0,0xBA,0xF0,0x9D,0xF0,0x6F,0xF0,0x5F,0xF0,0x5E,0xF0,0x8B,0xF0,0xA9,0xF0,0xC7,0xF0,0xC6,0xF0,0xD6,0x65,0xF0,0x25,0x65,0xF0,0x25,0x65,0xF0,0x25,0x66,0xF0,0x15,0x75,0xF0,0x15,0x76,0xE5,0x96,0xD5,0x97,0xA6,0xB8,0x68,0xCF,0x05,0xEF,0x03,0xF0,0x2E,0xF0,0x78,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC0, // 0x53    83    'S'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xBF,0x0E,0x2F,0x0E,0x2F,0x0E,0x2F,0x0E,0xE5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xB5,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x90, // 0x54    84    'T'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x45,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x95,0xF0,0x15,0xA5,0xF0,0x15,0xA5,0xF0,0x15,0xA6,0xE5,0xC6,0xC6,0xD7,0x87,0xFF,0x05,0xF0,0x2F,0x03,0xF0,0x4F,0xF0,0x9A,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD0, // 0x55    85    'U'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF5,0xF0,0x8B,0xF0,0x66,0x15,0xF0,0x65,0x25,0xF0,0x65,0x26,0xF0,0x46,0x35,0xF0,0x45,0x45,0xF0,0x45,0x46,0xF0,0x26,0x55,0xF0,0x25,0x66,0xF6,0x75,0xF5,0x85,0xF5,0x86,0xD6,0x95,0xD5,0xA5,0xD5,0xA6,0xB6,0xB5,0xB5,0xC6,0x96,0xC6,0x96,0xD5,0x95,0xE6,0x76,0xF5,0x75,0xF0,0x15,0x75,0xF0,0x16,0x56,0xF0,0x25,0x55,0xF0,0x35,0x46,0xF0,0x36,0x36,0xF0,0x45,0x35,0xF0,0x56,0x16,0xF0,0x65,0x16,0xF0,0x65,0x15,0xF0,0x7B,0xF0,0x89,0xF0,0x99,0xF0,0x99,0xF0,0xA7,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x10, // 0x56    86    'V'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x65,0xF0,0x25,0xF0,0x25,0x16,0xF7,0xF0,0x15,0x25,0xF7,0xF5,0x35,0xF7,0xF5,0x35,0xE4,0x14,0xE5,0x35,0xE4,0x14,0xE5,0x45,0xD4,0x14,0xD5,0x55,0xD4,0x15,0xC5,0x55,0xC4,0x34,0xC5,0x64,0xC4,0x34,0xC4,0x75,0xB4,0x34,0xB5,0x75,0xA4,0x54,0xA5,0x75,0xA4,0x54,0xA5,0x84,0xA4,0x54,0xA4,0x95,0x85,0x64,0x85,0x95,0x84,0x74,0x85,0x95,0x84,0x74,0x85,0xA4,0x75,0x75,0x74,0xB5,0x64,0x94,0x65,0xB5,0x64,0x94,0x65,0xB5,0x64,0x94,0x65,0xC4,0x54,0xB4,0x54,0xD5,0x44,0xB4,0x54,0xD5,0x44,0xB4,0x45,0xE4,0x35,0xB5,0x34,0xF4,0x34,0xD4,0x34,0xF4,0x34,0xD4,0x34,0xF5,0x15,0xD4,0x25,0xF0,0x14,0x14,0xF4,0x14,0xF0,0x24,0x14,0xF4,0x14,0xF0,0x24,0x14,0xF4,0x14,0xF0,0x28,0xF0,0x28,0xF0,0x37,0xF0,0x27,0xF0,0x47,0xF0,0x27,0xF0,0x47,0xF0,0x27,0xF0,0x46,0xF0,0x46,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x40, // 0x57    87    'W'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x26,0xF0,0x26,0x56,0xF6,0x76,0xD6,0x86,0xD6,0x96,0xB6,0xB6,0x96,0xD5,0x87,0xD6,0x76,0xF6,0x56,0xF0,0x26,0x36,0xF0,0x36,0x36,0xF0,0x46,0x16,0xF0,0x6B,0xF0,0x7B,0xF0,0x89,0xF0,0xA7,0xF0,0xC6,0xF0,0xB7,0xF0,0xA9,0xF0,0x8B,0xF0,0x7B,0xF0,0x66,0x16,0xF0,0x46,0x36,0xF0,0x36,0x36,0xF0,0x26,0x56,0xF6,0x76,0xE6,0x76,0xD6,0x96,0xB6,0xB6,0x97,0xC5,0x96,0xD6,0x76,0xF6,0x56,0xF0,0x26,0x46,0xF0,0x26,0x36,0xF0,0x46,0x16,0xF0,0x66,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0x58    88    'X'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF6,0xF0,0x66,0x16,0xF0,0x46,0x36,0xF0,0x26,0x46,0xF0,0x26,0x56,0xF6,0x76,0xD6,0x86,0xD6,0x96,0xB6,0xB6,0x96,0xC6,0x96,0xD6,0x76,0xF6,0x56,0xF0,0x16,0x56,0xF0,0x26,0x36,0xF0,0x46,0x16,0xF0,0x56,0x16,0xF0,0x6B,0xF0,0x89,0xF0,0x99,0xF0,0xA7,0xF0,0xC5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x20, // 0x59    89    'Y'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xDF,0x0B,0x5F,0x0B,0x5F,0x0B,0x5F,0x0B,0xF0,0xA6,0xF0,0x96,0xF0,0x96,0xF0,0x96,0xF0,0x96,0xF0,0xA6,0xF0,0x96,0xF0,0x96,0xF0,0x96,0xF0,0x97,0xF0,0x96,0xF0,0x96,0xF0,0x96,0xF0,0x96,0xF0,0x97,0xF0,0x96,0xF0,0x96,0xF0,0x96,0xF0,0x96,0xF0,0xA6,0xF0,0x96,0xF0,0x96,0xF0,0x96,0xF0,0x97,0xF0,0x96,0xF0,0x96,0xF0,0x96,0xF0,0x96,0xF0,0xAF,0x0E,0x2F,0x0E,0x2F,0x0E,0x2F,0x0E,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC0, // 0x5A    90    'Z'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x89,0x59,0x59,0x59,0x54,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA9,0x59,0x59,0x59,0xF0,0x10, // 0x5B    91    '['
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x54,0xA4,0xB4,0xA4,0xA4,0xA5,0xA4,0xA4,0xA4,0xB4,0xA4,0xA4,0xA4,0xB4,0xA4,0xA4,0xA5,0xA4,0xA4,0xA4,0xB4,0xA4,0xA4,0xA5,0xA4,0xA4,0xA4,0xB4,0xA4,0xA4,0xA4,0xB4,0xA4,0xA4,0xA5,0xA4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x40, // 0x5C    92    '\'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x79,0x59,0x59,0x59,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0x59,0x59,0x59,0x59,0xF0,0x20, // 0x5D    93    ']'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x44,0xF0,0x26,0xF0,0x16,0xF0,0x16,0xF8,0xE3,0x23,0xD4,0x24,0xC4,0x24,0xB4,0x44,0xA4,0x44,0xA3,0x63,0x94,0x64,0x84,0x64,0x74,0x84,0x64,0x84,0x54,0xA4,0x44,0xA4,0x44,0xA4,0x34,0xC4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x20, // 0x5E    94    '^'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x1F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x07,0xF0,0xD0, // 0x5F    95    '_'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x76,0xC6,0xC5,0xD5,0xD4,0xE3,0xF3,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB0, // 0x60    96    '`'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x29,0xF0,0x2E,0xCF,0x02,0xAF,0x04,0x87,0x76,0x85,0xB5,0x65,0xD4,0x65,0xD4,0x82,0xE4,0xF0,0x94,0xF0,0x76,0xF0,0x1C,0xBF,0x02,0x8F,0x05,0x7F,0x24,0x6A,0x84,0x65,0xD4,0x55,0xE4,0x54,0xF4,0x54,0xE5,0x54,0xD6,0x55,0xB7,0x66,0x6A,0x6F,0x07,0x7F,0x01,0x14,0x8D,0x35,0x99,0x64,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA0, // 0x61    97    'a'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD4,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0x47,0xD4,0x2B,0xB4,0x1E,0x9F,0x05,0x89,0x57,0x77,0x95,0x76,0xB5,0x65,0xD4,0x65,0xD4,0x65,0xE4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xE5,0x55,0xD4,0x65,0xD4,0x66,0xB5,0x67,0x95,0x79,0x56,0x84,0x1E,0x94,0x1D,0xA4,0x3A,0xB4,0x47,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0x62    98    'b'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x57,0xF0,0x1C,0xBF,0x9F,0x02,0x77,0x57,0x65,0x95,0x55,0xB5,0x44,0xC5,0x44,0xD2,0x54,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF2,0x54,0xE4,0x34,0xD5,0x35,0xC4,0x55,0xA5,0x57,0x66,0x7F,0x03,0x8F,0xCC,0xF8,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC0, // 0x63    99    'c'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x14,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xD7,0x44,0xBB,0x24,0x9E,0x14,0x8F,0x05,0x77,0x59,0x75,0x97,0x65,0xB6,0x64,0xD5,0x64,0xD5,0x54,0xE5,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x55,0xE4,0x64,0xD5,0x64,0xD5,0x65,0xB6,0x75,0x97,0x86,0x59,0x8F,0x14,0xAD,0x14,0xBA,0x34,0xD6,0x54,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB0, // 0x64    100   'd'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x28,0xF0,0x3C,0xFF,0xBF,0x03,0xA6,0x66,0x95,0xA5,0x75,0xC5,0x64,0xE4,0x64,0xE4,0x54,0xF0,0x14,0x44,0xF0,0x14,0x4F,0x09,0x4F,0x09,0x4F,0x09,0x4F,0x09,0x44,0xF0,0x94,0xF0,0x94,0xF0,0xA4,0xF2,0x74,0xE5,0x55,0xC5,0x75,0xA6,0x77,0x76,0x9F,0x03,0xBF,0x01,0xED,0xF0,0x29,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x20, // 0x65    101   'e'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC7,0x68,0x59,0x4A,0x45,0x94,0xA4,0xA4,0xA4,0xA4,0x6D,0x1D,0x1D,0x1D,0x54,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA0, // 0x66    102   'f'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x26,0xF0,0x5A,0x34,0x9E,0x14,0x8F,0x05,0x86,0x59,0x75,0x97,0x65,0xB6,0x64,0xD5,0x64,0xD5,0x54,0xE5,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xE5,0x64,0xD5,0x64,0xD5,0x65,0xB6,0x75,0x97,0x86,0x59,0x8F,0x05,0x9E,0x14,0xBB,0x24,0xD7,0x44,0xF0,0x94,0x62,0xF0,0x14,0x64,0xD4,0x74,0xD4,0x75,0xB5,0x86,0x76,0xAF,0x03,0xAF,0x01,0xED,0xF0,0x29,0xF0,0xF0,0x80, // 0x67    103   'g'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD4,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0x57,0xC4,0x3B,0xA4,0x1F,0x8F,0x06,0x79,0x66,0x77,0x95,0x76,0xB5,0x65,0xD4,0x65,0xD4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB0, // 0x68    104   'h'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x44,0x84,0x84,0x84,0xF0,0xF0,0xF0,0xF0,0xF0,0x54,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x10, // 0x69    105   'i'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD4,0x64,0x64,0x64,0xF0,0xF0,0xF0,0xF0,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x55,0x38,0x28,0x25,0x12,0x24,0x22,0xC0, // 0x6A    106   'j'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD4,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xB5,0x54,0xA5,0x64,0x95,0x74,0x85,0x84,0x75,0x94,0x65,0xA4,0x55,0xB4,0x45,0xC4,0x35,0xD4,0x25,0xE4,0x16,0xEC,0xDD,0xC7,0x25,0xB6,0x44,0xB5,0x55,0xA4,0x75,0x94,0x84,0x94,0x85,0x84,0x95,0x74,0xA4,0x74,0xA5,0x64,0xB5,0x54,0xC4,0x54,0xC5,0x44,0xD5,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x50, // 0x6B    107   'k'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x44,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x10, // 0x6C    108   'l'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x75,0x96,0xB4,0x39,0x5A,0x94,0x1C,0x3C,0x84,0x1D,0x1E,0x78,0x55,0x14,0x55,0x76,0x87,0x85,0x65,0x96,0xA4,0x65,0xA5,0xA4,0x65,0xA4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0x64,0xB4,0xB4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x80, // 0x6D    109   'm'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x47,0xC4,0x3C,0x94,0x2E,0x84,0x1F,0x01,0x79,0x66,0x77,0x95,0x76,0xB5,0x65,0xD4,0x65,0xD4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB0, // 0x6E    110   'n'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x28,0xF0,0x3C,0xEF,0x01,0xBF,0x03,0x97,0x66,0x95,0xA5,0x75,0xC5,0x64,0xE4,0x64,0xE4,0x55,0xE5,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x45,0xE5,0x54,0xE4,0x64,0xE4,0x65,0xC5,0x75,0xA5,0x87,0x67,0x9F,0x03,0xBF,0x01,0xEC,0xF0,0x38,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0x6F    111   'o'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x46,0xD4,0x3A,0xB4,0x2D,0x94,0x1F,0x89,0x57,0x77,0x95,0x76,0xB5,0x66,0xC4,0x65,0xD4,0x65,0xE4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xE5,0x55,0xD4,0x65,0xD4,0x66,0xB4,0x77,0x95,0x79,0x56,0x8F,0x04,0x94,0x1D,0xA4,0x2B,0xB4,0x47,0xD4,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0xF0,0xF0,0x40, // 0x70    112   'p'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x26,0xF0,0x5A,0x34,0x9D,0x24,0x8F,0x14,0x77,0x59,0x75,0x97,0x65,0xB6,0x64,0xC6,0x64,0xD5,0x54,0xE5,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x55,0xE4,0x64,0xD5,0x64,0xD5,0x65,0xB6,0x75,0x97,0x86,0x59,0x9F,0x04,0xAD,0x14,0xBB,0x24,0xD7,0x44,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0xF0,0x10, // 0x71    113   'q'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x35,0x53,0x29,0x33,0x1A,0x3D,0x47,0x42,0x46,0xB5,0xC5,0xC5,0xC4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x20, // 0x72    114   'r'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x47,0xFD,0xBF,0x9F,0x02,0x85,0x66,0x75,0x95,0x64,0xB4,0x64,0xB2,0x85,0xF0,0x56,0xF0,0x59,0xF0,0x1C,0xEE,0xCF,0xDD,0xFA,0xF0,0x47,0xF0,0x55,0x62,0xD4,0x44,0xD4,0x45,0xC4,0x55,0xA4,0x67,0x66,0x7F,0x02,0x9F,0xBD,0xE9,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD0, // 0x73    115   's'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB1,0xC2,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0x7B,0x3B,0x3B,0x3B,0x64,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA5,0x98,0x77,0x78,0x86,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x50, // 0x74    116   't'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x84,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xD5,0x64,0xD5,0x65,0xB6,0x66,0x97,0x76,0x69,0x7F,0x01,0x14,0x8E,0x24,0x9C,0x34,0xC7,0x54,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB0, // 0x75    117   'u'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x64,0xF4,0x34,0xD4,0x44,0xD4,0x44,0xD4,0x54,0xB4,0x64,0xB4,0x65,0x95,0x74,0x94,0x84,0x94,0x85,0x75,0x94,0x74,0xA4,0x74,0xB4,0x54,0xC4,0x54,0xC5,0x44,0xD4,0x34,0xE4,0x34,0xE5,0x15,0xF4,0x14,0xF0,0x14,0x14,0xF0,0x14,0x14,0xF0,0x27,0xF0,0x37,0xF0,0x46,0xF0,0x45,0xF0,0x55,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0, // 0x76    118   'v'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA4,0xB5,0xB8,0xB5,0xB9,0xA5,0xA5,0x14,0xA6,0x94,0x24,0x97,0x94,0x25,0x87,0x84,0x44,0x83,0x13,0x84,0x44,0x83,0x14,0x74,0x54,0x64,0x14,0x64,0x64,0x64,0x14,0x64,0x64,0x63,0x24,0x64,0x74,0x53,0x34,0x44,0x84,0x44,0x34,0x44,0x84,0x44,0x34,0x44,0x94,0x33,0x44,0x34,0xA4,0x24,0x54,0x24,0xA4,0x24,0x54,0x23,0xC4,0x14,0x54,0x14,0xC4,0x13,0x64,0x14,0xD3,0x13,0x73,0x13,0xE7,0x77,0xE7,0x77,0xF6,0x76,0xF0,0x15,0x95,0xF0,0x15,0x95,0xF0,0x24,0x94,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x40, // 0x77    119   'w'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x15,0xD4,0x35,0xB5,0x44,0xA5,0x55,0x85,0x75,0x74,0x95,0x55,0xA4,0x45,0xB5,0x25,0xD5,0x15,0xE9,0xF8,0xF0,0x26,0xF0,0x45,0xF0,0x36,0xF0,0x28,0xF0,0x19,0xE5,0x14,0xD5,0x25,0xB5,0x45,0xA4,0x64,0x95,0x65,0x75,0x85,0x64,0xA5,0x45,0xB4,0x35,0xC5,0x15,0xE5,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x90, // 0x78    120   'x'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x64,0xF4,0x34,0xD5,0x34,0xD4,0x44,0xD4,0x54,0xB4,0x64,0xB4,0x65,0x95,0x74,0x94,0x84,0x94,0x85,0x75,0x94,0x74,0xA4,0x74,0xA5,0x54,0xC4,0x54,0xC4,0x45,0xC5,0x34,0xE4,0x34,0xE4,0x25,0xE5,0x14,0xF0,0x19,0xF0,0x18,0xF0,0x28,0xF0,0x37,0xF0,0x36,0xF0,0x55,0xF0,0x54,0xF0,0x64,0xF0,0x55,0xF0,0x54,0xF0,0x64,0xF0,0x54,0xF0,0x55,0xF9,0xF0,0x19,0xF0,0x27,0xF0,0x35,0xF0,0xF0,0xC0, // 0x79    121   'y'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x7F,0x06,0x4F,0x06,0x4F,0x06,0x4F,0x06,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x46,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x55,0xF0,0x45,0xF0,0x4F,0x08,0x2F,0x08,0x2F,0x08,0x2F,0x08,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x60, // 0x7A    122   'z'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF5,0xA7,0x98,0x98,0x85,0xC4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xC4,0xD4,0xB5,0xA6,0xB5,0xC5,0xC6,0xD5,0xE4,0xD4,0xE4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD5,0xD8,0x98,0xA7,0xC5,0xF0,0x40, // 0x7B    123   '{'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x44,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x40, // 0x7C    124   '|'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x75,0xC7,0xA8,0x98,0xD5,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xE4,0xD4,0xE5,0xD6,0xC5,0xC5,0xA7,0xA5,0xB4,0xC5,0xC4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xC5,0x88,0x98,0x97,0xA5,0xF0,0xC0, // 0x7D    125   '}'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC6,0xF0,0x6A,0xC1,0x5D,0x83,0x4F,0x01,0x54,0x4F,0x0A,0x44,0x5F,0x01,0x42,0x9D,0x51,0xCA,0xF0,0x66,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC0, // 0x7E    126   '~'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB4,0xC4,0xC4,0xC4,0xF0,0xF0,0xF0,0xF0,0xF0,0x22,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xD4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xC4,0xF0,0x70, // 0xA1    161   '¡'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE2,0xF0,0xB3,0xF0,0x93,0xF0,0xA3,0xF0,0xA3,0xF0,0xA3,0xF0,0x93,0xF0,0xA3,0xF0,0xA3,0xF0,0x39,0xF0,0x2C,0xEF,0x01,0xBF,0x03,0x97,0x48,0x95,0x63,0x15,0x75,0x63,0x25,0x74,0x73,0x34,0x74,0x73,0x35,0x55,0x64,0xD4,0x73,0xE4,0x73,0xE4,0x73,0xE4,0x63,0xF4,0x63,0xF4,0x63,0xF4,0x53,0xF0,0x14,0x53,0x72,0x84,0x43,0x74,0x64,0x33,0x75,0x65,0x23,0x74,0x85,0x13,0x56,0x88,0x56,0xAF,0x02,0xCF,0xED,0xF0,0x19,0xF0,0x43,0xF0,0xA3,0xF0,0x93,0xF0,0xA3,0xF0,0xA3,0xF0,0x93,0xF0,0xA3,0xF0,0xA3,0xF0,0x93,0xF0,0xB2,0xF0,0xF0,0xF0,0x30, // 0xA2    162   '¢'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x68,0xF0,0x3C,0xEF,0x01,0xBF,0x03,0x97,0x66,0x95,0x96,0x75,0xB5,0x74,0xD5,0x64,0xE4,0x64,0xE2,0x84,0xF0,0x94,0xF0,0x94,0xF0,0xA4,0xF0,0x94,0xF0,0x94,0xF0,0x6F,0x01,0xCF,0x01,0xCF,0x01,0xCF,0x01,0xF0,0x24,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x93,0xF0,0x94,0xF0,0x93,0xF0,0x93,0xF0,0x94,0xF0,0x8B,0xB1,0x4F,0x01,0x53,0x3F,0x0B,0x3F,0x0A,0x44,0x7C,0x52,0xD6,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC0, // 0xA3    163   '£'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD1,0xF0,0x11,0x84,0x46,0x44,0x56,0x1A,0x16,0x5F,0x07,0x7F,0x05,0xA6,0x46,0xB5,0x85,0xA4,0xA4,0x95,0xA5,0x84,0xC4,0x84,0xC4,0x84,0xC4,0x84,0xC4,0x85,0xA5,0x94,0xA4,0xA5,0x85,0xB6,0x46,0xBF,0x03,0x8F,0x07,0x56,0x1A,0x16,0x54,0x46,0x44,0x81,0xF0,0x11,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x20, // 0xA4    164   '¤'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA4,0xF0,0x34,0x34,0xF0,0x14,0x44,0xF0,0x14,0x54,0xE4,0x64,0xD5,0x74,0xC4,0x85,0xA5,0x94,0xA4,0xA5,0x85,0xB4,0x84,0xC5,0x65,0xD4,0x64,0xE5,0x45,0xF4,0x44,0xF0,0x15,0x25,0xF0,0x24,0x15,0xF0,0x3A,0xF0,0x48,0xCF,0x09,0x4F,0x09,0x4F,0x09,0x4F,0x09,0xE4,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xEF,0x09,0x4F,0x09,0x4F,0x09,0x4F,0x09,0xE4,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x60, // 0xA5    165   '¥'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x44,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE4,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x40, // 0xA6    166   '¦'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x58,0xF0,0x3C,0xEF,0xCF,0x02,0xB6,0x66,0x95,0x95,0x94,0xB5,0x84,0xC4,0x84,0xC2,0xA5,0xF0,0x95,0xF0,0x86,0xF0,0x87,0xF0,0x78,0xF0,0x3B,0xF0,0x15,0x18,0xD4,0x49,0xB4,0x69,0x84,0x98,0x74,0xB7,0x64,0xC7,0x54,0xE5,0x55,0xE5,0x55,0xE4,0x56,0xD4,0x67,0xB4,0x78,0x94,0x98,0x64,0xB9,0x34,0xED,0xF0,0x29,0xF0,0x67,0xF0,0x77,0xF0,0x86,0xF0,0x85,0xF0,0x95,0x92,0xD4,0x74,0xD4,0x75,0xC4,0x84,0xB5,0x85,0xA4,0xA6,0x66,0xAF,0x02,0xCF,0xFC,0xF0,0x38,0xF0,0xF0,0x80, // 0xA7    167   '§'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x64,0x44,0x54,0x44,0x54,0x44,0x54,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0, // 0xA8    168   '¨'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x29,0xF0,0xAF,0xF0,0x5F,0x04,0xF0,0x27,0x77,0xE6,0xD6,0xB5,0xF0,0x25,0x95,0xF0,0x45,0x84,0xF0,0x64,0x74,0x97,0x74,0x54,0x7C,0x64,0x43,0x7E,0x63,0x34,0x65,0x65,0x54,0x23,0x65,0x84,0x63,0x23,0x63,0xB4,0x53,0x14,0x63,0xC2,0x67,0x63,0xF0,0x76,0x63,0xF0,0x76,0x63,0xF0,0x76,0x63,0xF0,0x76,0x63,0xF0,0x76,0x63,0xF0,0x76,0x63,0xD2,0x77,0x63,0xB4,0x54,0x13,0x63,0xB4,0x53,0x23,0x64,0x94,0x63,0x24,0x65,0x55,0x64,0x33,0x7D,0x73,0x44,0x7B,0x74,0x54,0x87,0x84,0x74,0xF0,0x64,0x85,0xF0,0x45,0x95,0xF0,0x25,0xB6,0xD6,0xE7,0x77,0xF0,0x2F,0x04,0xF0,0x5F,0xF0,0xA9,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x10, // 0xA9    169   '©'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x17,0xAB,0x7D,0x55,0x55,0x44,0x74,0x62,0x74,0xF4,0xA9,0x6D,0x4A,0x14,0x45,0x64,0x34,0x84,0x34,0x84,0x34,0x75,0x35,0x56,0x4F,0x59,0x14,0x66,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC0, // 0xAA    170   'ª'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC4,0x54,0xE4,0x54,0xE4,0x54,0xE5,0x45,0xE4,0x54,0xE5,0x45,0xD5,0x45,0xE4,0x54,0xE5,0x45,0xD5,0x45,0xD5,0x45,0xE5,0x45,0xF5,0x45,0xF5,0x45,0xF4,0x54,0xF5,0x45,0xF4,0x54,0xF0,0x14,0x54,0xF5,0x45,0xF4,0x54,0xF0,0x14,0x54,0xF0,0x14,0x54,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x80, // 0xAB    171   '«'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xCF,0x08,0x6F,0x08,0x6F,0x08,0x6F,0x08,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC0, // 0xAC    172   '¬'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x4E,0x3E,0x3E,0x3E,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0, // 0xAD    173   '­'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x29,0xF0,0xAF,0xF0,0x5F,0x04,0xF0,0x27,0x77,0xE6,0xD6,0xB5,0xF0,0x25,0x95,0xF0,0x45,0x84,0xF0,0x64,0x74,0x3C,0x84,0x54,0x4E,0x74,0x43,0x5F,0x73,0x34,0x53,0x84,0x74,0x23,0x63,0xA3,0x73,0x23,0x63,0xA3,0x73,0x14,0x63,0xA3,0x77,0x73,0xA3,0x86,0x73,0x84,0x96,0x7F,0x96,0x7E,0xA6,0x7C,0xC6,0x73,0x35,0xD6,0x73,0x54,0xC7,0x63,0x64,0xA4,0x13,0x63,0x73,0xA3,0x23,0x63,0x83,0x93,0x24,0x53,0x84,0x74,0x33,0x53,0x93,0x73,0x44,0x43,0xA3,0x54,0x54,0x33,0xA4,0x34,0x74,0xF0,0x64,0x85,0xF0,0x45,0x95,0xF0,0x25,0xB6,0xD6,0xE7,0x77,0xF0,0x2F,0x04,0xF0,0x5F,0xF0,0xA9,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x10, // 0xAE    174   '®'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x7F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x07,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x70, // 0xAF    175   '¯'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC6,0xD8,0xBA,0x94,0x44,0x74,0x64,0x63,0x83,0x63,0x83,0x63,0x83,0x63,0x83,0x64,0x64,0x74,0x44,0x9A,0xB8,0xD6,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x70, // 0xB0    176   '°'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x94,0xF0,0x84,0xF0,0x84,0xF0,0x84,0xF0,0x84,0xF0,0x84,0xF0,0x84,0xF0,0x84,0xF0,0x84,0xF0,0x84,0xDF,0x09,0x3F,0x09,0x3F,0x09,0x3F,0x09,0xD4,0xF0,0x84,0xF0,0x84,0xF0,0x84,0xF0,0x84,0xF0,0x84,0xF0,0x84,0xF0,0x84,0xF0,0x84,0xF0,0x84,0xF0,0xF0,0xF0,0xF0,0x7F,0x09,0x3F,0x09,0x3F,0x09,0x3F,0x09,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD0, // 0xB1    177   '±'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA7,0x8A,0x6C,0x54,0x45,0x35,0x54,0x52,0x64,0xD4,0xC4,0xC5,0xB5,0xA6,0xA5,0xB5,0xB5,0xB5,0xBE,0x2F,0x2F,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0, // 0xB2    178   '²'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA6,0x9A,0x6C,0x54,0x35,0x45,0x44,0x62,0x54,0xC4,0xA6,0xB6,0xB7,0xE4,0xE4,0x42,0x74,0x25,0x64,0x26,0x45,0x3D,0x5B,0x87,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x40, // 0xB3    179   '³'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE6,0xA6,0xB5,0xB5,0xC4,0xD3,0xD3,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD0, // 0xB4    180   '´'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE4,0xE4,0x74,0xE4,0x74,0xE4,0x74,0xE4,0x74,0xE4,0x74,0xE4,0x74,0xE4,0x74,0xE4,0x74,0xE4,0x74,0xE4,0x74,0xE4,0x74,0xE4,0x74,0xE4,0x74,0xE4,0x74,0xE4,0x74,0xE4,0x74,0xE4,0x74,0xD5,0x75,0xC5,0x75,0xB6,0x76,0x97,0x78,0x68,0x7F,0x07,0x74,0x1C,0x14,0x74,0x2A,0x24,0x74,0x46,0x44,0x74,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xA4,0xF0,0xF0,0xF0,0x50, // 0xB5    181   'µ'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x7F,0x05,0x5F,0x07,0x3F,0x09,0x2F,0x0A,0x1D,0x64,0x4D,0x64,0x4D,0x64,0x3E,0x64,0x3E,0x64,0x3E,0x64,0x3E,0x64,0x3E,0x64,0x3E,0x64,0x3E,0x64,0x4D,0x64,0x4D,0x64,0x5C,0x64,0x6B,0x64,0x7A,0x64,0xA7,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xD4,0x64,0xF0,0xF0, // 0xB6    182   '¶'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x74,0xA4,0xA4,0xA4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA0, // 0xB7    183   '·'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x83,0xE3,0xD4,0xD7,0xD5,0xD4,0xC5,0x6A,0x79,0x87,0xF0,0xA0, // 0xB8    184   '¸'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE4,0xC5,0xB6,0x89,0x7A,0x75,0x14,0x73,0x34,0x71,0x54,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xD4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x20, // 0xB9    185   '¹'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x66,0xAA,0x7C,0x55,0x45,0x44,0x64,0x35,0x65,0x24,0x84,0x24,0x84,0x24,0x84,0x24,0x84,0x24,0x84,0x24,0x84,0x25,0x65,0x34,0x64,0x45,0x45,0x5C,0x7A,0xA6,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0xBA    186   'º'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x54,0x54,0xF0,0x14,0x54,0xF0,0x14,0x54,0xF5,0x45,0xF4,0x54,0xF0,0x14,0x54,0xF5,0x45,0xF4,0x54,0xF5,0x45,0xF5,0x45,0xF5,0x45,0xE5,0x45,0xD5,0x45,0xD5,0x45,0xE4,0x54,0xE5,0x45,0xD5,0x45,0xE4,0x54,0xE5,0x45,0xE4,0x54,0xE4,0x54,0xE4,0x54,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0, // 0xBB    187   '»'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x94,0xF0,0x45,0xD5,0xF0,0x35,0xD6,0xF0,0x34,0xB9,0xF0,0x25,0xAA,0xF0,0x15,0xB5,0x14,0xF5,0xC3,0x34,0xF4,0xD1,0x54,0xE5,0xF0,0x44,0xD5,0xF0,0x54,0xC5,0xF0,0x64,0xC4,0xF0,0x74,0xB5,0xF0,0x74,0xA5,0xF0,0x84,0xA4,0xF0,0x94,0x95,0xF0,0x94,0x85,0xF0,0xA4,0x75,0xF0,0xB4,0x74,0xF0,0xF0,0x75,0xB4,0xF0,0x65,0xB5,0xF0,0x55,0xC5,0xF0,0x54,0xC6,0xF0,0x45,0xB7,0xF0,0x35,0xB8,0xF0,0x25,0xB4,0x14,0xF0,0x24,0xB4,0x24,0xF0,0x15,0xB4,0x24,0xF5,0xB4,0x34,0xF4,0xB4,0x44,0xE5,0xA4,0x54,0xD5,0xBF,0x01,0x95,0xCF,0x01,0x94,0xF0,0x74,0xB5,0xF0,0x74,0xA5,0xF0,0x84,0x95,0xF0,0x94,0x94,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x20, // 0xBC    188   '¼'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x84,0xF0,0x55,0xC5,0xF0,0x54,0xC6,0xF0,0x45,0x99,0xF0,0x35,0x9A,0xF0,0x25,0xA5,0x14,0xF0,0x24,0xB3,0x34,0xF0,0x15,0xB1,0x54,0xF5,0xF0,0x34,0xE5,0xF0,0x44,0xE4,0xF0,0x54,0xD5,0xF0,0x54,0xC5,0xF0,0x64,0xC4,0xF0,0x74,0xB5,0xF0,0x74,0xA5,0xF0,0x84,0x95,0xF0,0x94,0x94,0xF0,0xA4,0x85,0xF0,0xF0,0x65,0x67,0xF0,0x85,0x5B,0xF0,0x64,0x5D,0xF0,0x45,0x55,0x45,0xF0,0x25,0x55,0x64,0xF0,0x15,0x64,0x74,0xF0,0x14,0xF0,0x34,0xF5,0xF0,0x24,0xF5,0xF0,0x25,0xF4,0xF0,0x25,0xF5,0xF5,0xF0,0x15,0xF5,0xF0,0x15,0xE6,0xF0,0x24,0xE5,0xF0,0x35,0xD5,0xF0,0x35,0xDF,0x85,0xEF,0x84,0xEF,0x01,0x75,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x10, // 0xBD    189   '½'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x66,0xF0,0x65,0x8A,0xF0,0x35,0x8C,0xF0,0x15,0x94,0x35,0xF0,0x14,0x95,0x44,0xF5,0x94,0x54,0xE5,0xC2,0x44,0xE5,0xF0,0x16,0xF5,0xF0,0x16,0xE5,0xF0,0x27,0xC5,0xF0,0x74,0xB4,0xF0,0x94,0x95,0xD4,0x74,0x85,0xE5,0x64,0x75,0xF0,0x15,0x45,0x74,0xF0,0x2D,0x75,0xF0,0x3B,0x75,0xF0,0x67,0x85,0xF0,0xF0,0x74,0xB4,0xF0,0x75,0xA5,0xF0,0x65,0xA6,0xF0,0x64,0xB6,0xF0,0x55,0xA7,0xF0,0x45,0xA8,0xF0,0x35,0xA4,0x14,0xF0,0x34,0xA4,0x24,0xF0,0x25,0x95,0x24,0xF0,0x15,0x95,0x34,0xF5,0xA4,0x44,0xF4,0xA4,0x54,0xE5,0xAF,0x01,0xA5,0xBF,0x01,0x95,0xF0,0x64,0xC5,0xF0,0x64,0xB5,0xF0,0x74,0xA5,0xF0,0x84,0xA4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x10, // 0xBE    190   '¾'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x34,0xF0,0xC4,0xF0,0xC4,0xF0,0xC4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x14,0xF0,0xC4,0xF0,0xC4,0xF0,0xC4,0xF0,0xB5,0xF0,0xB4,0xF0,0xB5,0xF0,0xA6,0xF0,0x96,0xF0,0x96,0xF0,0x96,0xF0,0xA5,0xF0,0xA5,0xF0,0xA5,0xF0,0xB4,0xF0,0xB4,0xF0,0xC4,0xF0,0xC4,0xF2,0xA4,0xF4,0x84,0xE5,0x85,0xD4,0xA5,0xB5,0xA6,0x96,0xB6,0x67,0xCF,0x03,0xFF,0xF0,0x2D,0xF0,0x59,0xF0,0xF0,0xC0, // 0xBF    191   '¿'
+  0xB6,0xF0,0xD6,0xF0,0xD5,0xF0,0xE5,0xF0,0xE4,0xF0,0xF3,0xF0,0xF0,0x13,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x65,0xF0,0xC7,0xF0,0xB7,0xF0,0xA9,0xF0,0x94,0x14,0xF0,0x94,0x14,0xF0,0x85,0x15,0xF0,0x74,0x34,0xF0,0x65,0x35,0xF0,0x55,0x35,0xF0,0x54,0x54,0xF0,0x45,0x55,0xF0,0x34,0x74,0xF0,0x25,0x74,0xF0,0x25,0x75,0xF0,0x14,0x94,0xF5,0x95,0xE5,0x95,0xE4,0xB4,0xD5,0xB5,0xC5,0xB5,0xBF,0x08,0xAF,0x08,0xAF,0x08,0x9F,0x0A,0x85,0xF5,0x75,0xF0,0x25,0x65,0xF0,0x25,0x65,0xF0,0x25,0x55,0xF0,0x45,0x45,0xF0,0x45,0x36,0xF0,0x45,0x35,0xF0,0x65,0x25,0xF0,0x65,0x16,0xF0,0x6B,0xF0,0x85,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0xC0    192   'À'
+  0xF0,0x26,0xF0,0xB6,0xF0,0xC5,0xF0,0xC5,0xF0,0xD4,0xF0,0xE3,0xF0,0xE3,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x95,0xF0,0xC7,0xF0,0xB7,0xF0,0xA9,0xF0,0x94,0x14,0xF0,0x94,0x14,0xF0,0x85,0x15,0xF0,0x74,0x34,0xF0,0x65,0x35,0xF0,0x55,0x35,0xF0,0x54,0x54,0xF0,0x45,0x55,0xF0,0x34,0x74,0xF0,0x25,0x74,0xF0,0x25,0x75,0xF0,0x14,0x94,0xF5,0x95,0xE5,0x95,0xE4,0xB4,0xD5,0xB5,0xC5,0xB5,0xBF,0x08,0xAF,0x08,0xAF,0x08,0x9F,0x0A,0x85,0xF5,0x75,0xF0,0x25,0x65,0xF0,0x25,0x65,0xF0,0x25,0x55,0xF0,0x45,0x45,0xF0,0x45,0x36,0xF0,0x45,0x35,0xF0,0x65,0x25,0xF0,0x65,0x16,0xF0,0x6B,0xF0,0x85,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0xC1    193   'Á'
+  0xD5,0xF0,0xD6,0xF0,0xB7,0xF0,0xB3,0x23,0xF0,0x94,0x24,0xF0,0x74,0x43,0xF0,0x74,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x45,0xF0,0xC7,0xF0,0xB7,0xF0,0xA9,0xF0,0x94,0x14,0xF0,0x94,0x14,0xF0,0x85,0x15,0xF0,0x74,0x34,0xF0,0x65,0x35,0xF0,0x55,0x35,0xF0,0x54,0x54,0xF0,0x45,0x55,0xF0,0x34,0x74,0xF0,0x25,0x74,0xF0,0x25,0x75,0xF0,0x14,0x94,0xF5,0x95,0xE5,0x95,0xE4,0xB4,0xD5,0xB5,0xC5,0xB5,0xBF,0x08,0xAF,0x08,0xAF,0x08,0x9F,0x0A,0x85,0xF5,0x75,0xF0,0x25,0x65,0xF0,0x25,0x65,0xF0,0x25,0x55,0xF0,0x45,0x45,0xF0,0x45,0x36,0xF0,0x45,0x35,0xF0,0x65,0x25,0xF0,0x65,0x16,0xF0,0x6B,0xF0,0x85,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0xC2    194   'Â'
+  0xF0,0xF0,0xF4,0x44,0xF0,0x47,0x34,0xF0,0x4E,0xF0,0x3E,0xF0,0x44,0x37,0xF0,0x44,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x55,0xF0,0xC7,0xF0,0xB7,0xF0,0xA9,0xF0,0x94,0x14,0xF0,0x94,0x14,0xF0,0x85,0x15,0xF0,0x74,0x34,0xF0,0x65,0x35,0xF0,0x55,0x35,0xF0,0x54,0x54,0xF0,0x45,0x55,0xF0,0x34,0x74,0xF0,0x25,0x74,0xF0,0x25,0x75,0xF0,0x14,0x94,0xF5,0x95,0xE5,0x95,0xE4,0xB4,0xD5,0xB5,0xC5,0xB5,0xBF,0x08,0xAF,0x08,0xAF,0x08,0x9F,0x0A,0x85,0xF5,0x75,0xF0,0x25,0x65,0xF0,0x25,0x65,0xF0,0x25,0x55,0xF0,0x45,0x45,0xF0,0x45,0x36,0xF0,0x45,0x35,0xF0,0x65,0x25,0xF0,0x65,0x16,0xF0,0x6B,0xF0,0x85,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0xC3    195   'Ã'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x54,0x44,0xF0,0x64,0x44,0xF0,0x64,0x44,0xF0,0x64,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x35,0xF0,0xC7,0xF0,0xB7,0xF0,0xA9,0xF0,0x94,0x14,0xF0,0x94,0x14,0xF0,0x85,0x15,0xF0,0x74,0x34,0xF0,0x65,0x35,0xF0,0x55,0x35,0xF0,0x54,0x54,0xF0,0x45,0x55,0xF0,0x34,0x74,0xF0,0x25,0x74,0xF0,0x25,0x75,0xF0,0x14,0x94,0xF5,0x95,0xE5,0x95,0xE4,0xB4,0xD5,0xB5,0xC5,0xB5,0xBF,0x08,0xAF,0x08,0xAF,0x08,0x9F,0x0A,0x85,0xF5,0x75,0xF0,0x25,0x65,0xF0,0x25,0x65,0xF0,0x25,0x55,0xF0,0x45,0x45,0xF0,0x45,0x36,0xF0,0x45,0x35,0xF0,0x65,0x25,0xF0,0x65,0x16,0xF0,0x6B,0xF0,0x85,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0xC4    196   'Ä'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x85,0xF0,0xC7,0xF0,0xA3,0x33,0xF0,0x92,0x52,0xF0,0x92,0x52,0xF0,0x92,0x52,0xF0,0x93,0x33,0xF0,0xA7,0xF0,0xB7,0xF0,0xB7,0xF0,0xA9,0xF0,0x94,0x14,0xF0,0x94,0x14,0xF0,0x85,0x15,0xF0,0x74,0x34,0xF0,0x65,0x35,0xF0,0x55,0x35,0xF0,0x54,0x54,0xF0,0x45,0x55,0xF0,0x34,0x74,0xF0,0x25,0x74,0xF0,0x25,0x75,0xF0,0x14,0x94,0xF5,0x95,0xE5,0x95,0xE4,0xB4,0xD5,0xB5,0xC5,0xB5,0xBF,0x08,0xAF,0x08,0xAF,0x08,0x9F,0x0A,0x85,0xF5,0x75,0xF0,0x25,0x65,0xF0,0x25,0x65,0xF0,0x25,0x55,0xF0,0x45,0x45,0xF0,0x45,0x36,0xF0,0x45,0x35,0xF0,0x65,0x25,0xF0,0x65,0x16,0xF0,0x6B,0xF0,0x85,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0xC5    197   'Å'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x7F,0x0E,0xF0,0x5F,0x0F,0xF0,0x5F,0x0F,0xF0,0x4F,0x0F,0x01,0xF0,0x45,0x45,0xF0,0xF0,0x56,0x45,0xF0,0xF0,0x55,0x55,0xF0,0xF0,0x55,0x55,0xF0,0xF0,0x45,0x65,0xF0,0xF0,0x45,0x65,0xF0,0xF0,0x36,0x65,0xF0,0xF0,0x35,0x75,0xF0,0xF0,0x26,0x75,0xF0,0xF0,0x25,0x85,0xF0,0xF0,0x16,0x85,0xF0,0xF0,0x15,0x95,0xF0,0xF6,0x9F,0x06,0xE5,0xAF,0x06,0xD6,0xAF,0x06,0xD5,0xBF,0x06,0xC6,0xB5,0xF0,0xDF,0x07,0xF0,0xCF,0x08,0xF0,0xCF,0x08,0xF0,0xBF,0x09,0xF0,0xB5,0xE5,0xF0,0xA6,0xE5,0xF0,0xA5,0xF5,0xF0,0x96,0xF5,0xF0,0x95,0xF0,0x15,0xF0,0x86,0xF0,0x15,0xF0,0x85,0xF0,0x25,0xF0,0x76,0xF0,0x2F,0x08,0x45,0xF0,0x3F,0x08,0x36,0xF0,0x3F,0x08,0x35,0xF0,0x4F,0x08,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD0, // 0xC6    198   'Æ'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x98,0xF0,0xAD,0xF0,0x6F,0x02,0xF0,0x3F,0x04,0xF0,0x17,0x68,0xE6,0xA7,0xC6,0xC6,0xC5,0xE6,0xA5,0xF0,0x15,0xA5,0xF0,0x16,0x85,0xF0,0x35,0x85,0xF0,0x31,0xC5,0xF0,0xF6,0xF0,0xF5,0xF0,0xF0,0x15,0xF0,0xF0,0x15,0xF0,0xF0,0x15,0xF0,0xF0,0x15,0xF0,0xF0,0x15,0xF0,0xF0,0x15,0xF0,0xF0,0x15,0xF0,0xF0,0x15,0xF0,0xF0,0x15,0xF0,0xF0,0x25,0xF0,0xF0,0x15,0xF0,0x44,0x85,0xF0,0x36,0x75,0xF0,0x36,0x85,0xF0,0x25,0x95,0xF0,0x16,0xA5,0xF5,0xB6,0xD6,0xC6,0xB6,0xE7,0x68,0xF0,0x1F,0x04,0xF0,0x3F,0x02,0xF0,0x6D,0xF0,0xA9,0xF0,0xE3,0xF0,0xF0,0x24,0xF0,0xF0,0x27,0xF0,0xF0,0x25,0xF0,0xF0,0x24,0xF0,0xF0,0x15,0xF0,0xAA,0xF0,0xB9,0xF0,0xC7,0xF0,0xF0,0xF0,0x80, // 0xC7    199   'Ç'
+  0xA6,0xF0,0xD6,0xF0,0xD5,0xF0,0xE5,0xF0,0xE4,0xF0,0xF3,0xF0,0xF0,0x13,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xCF,0x0A,0x8F,0x0A,0x8F,0x0A,0x8F,0x0A,0x85,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xDF,0x09,0x9F,0x09,0x9F,0x09,0x9F,0x09,0x95,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xDF,0x0B,0x7F,0x0B,0x7F,0x0B,0x7F,0x0B,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x60, // 0xC8    200   'È'
+  0xF0,0x26,0xF0,0xB6,0xF0,0xC5,0xF0,0xC5,0xF0,0xD4,0xF0,0xE3,0xF0,0xE3,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xEF,0x0A,0x8F,0x0A,0x8F,0x0A,0x8F,0x0A,0x85,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xDF,0x09,0x9F,0x09,0x9F,0x09,0x9F,0x09,0x95,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xDF,0x0B,0x7F,0x0B,0x7F,0x0B,0x7F,0x0B,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x60, // 0xC9    201   'É'
+  0xE4,0xF0,0xD6,0xF0,0xB8,0xF0,0xA3,0x23,0xF0,0x94,0x24,0xF0,0x74,0x44,0xF0,0x64,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x9F,0x0A,0x8F,0x0A,0x8F,0x0A,0x8F,0x0A,0x85,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xDF,0x09,0x9F,0x09,0x9F,0x09,0x9F,0x09,0x95,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xDF,0x0B,0x7F,0x0B,0x7F,0x0B,0x7F,0x0B,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x60, // 0xCA    202   'Ê'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x64,0x44,0xF0,0x64,0x44,0xF0,0x64,0x44,0xF0,0x64,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x7F,0x0A,0x8F,0x0A,0x8F,0x0A,0x8F,0x0A,0x85,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xDF,0x09,0x9F,0x09,0x9F,0x09,0x9F,0x09,0x95,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xDF,0x0B,0x7F,0x0B,0x7F,0x0B,0x7F,0x0B,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x60, // 0xCB    203   'Ë'
+  0x26,0x96,0x95,0xA5,0xA4,0xB3,0xC3,0xF0,0xF0,0xF0,0x55,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x80, // 0xCC    204   'Ì'
+  0x76,0x76,0x85,0x85,0x94,0xA3,0xA3,0xF0,0xF0,0xF0,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x80, // 0xCD    205   'Í'
+  0x54,0x96,0x78,0x63,0x23,0x54,0x24,0x34,0x44,0x24,0x44,0xF0,0xF0,0xF0,0x35,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x80, // 0xCE    206   'Î'
+  0xF0,0xF0,0xE4,0x44,0x24,0x44,0x24,0x44,0x24,0x44,0xF0,0xF0,0xF0,0x25,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0x95,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x80, // 0xCF    207   'Ï'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x4F,0x03,0xF0,0x3F,0x06,0xFF,0x08,0xDF,0x09,0xC5,0xC8,0xB5,0xE7,0xA5,0xF0,0x15,0xA5,0xF0,0x16,0x95,0xF0,0x25,0x95,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x45,0x75,0xF0,0x45,0x75,0xF0,0x45,0x75,0xF0,0x45,0x3F,0x03,0xA5,0x3F,0x03,0xA5,0x3F,0x03,0xA5,0x3F,0x03,0xA5,0x75,0xF0,0x45,0x75,0xF0,0x45,0x75,0xF0,0x45,0x75,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x26,0x85,0xF0,0x25,0x95,0xF0,0x16,0x95,0xF0,0x15,0xA5,0xE7,0xA5,0xC8,0xBF,0x09,0xCF,0x08,0xDF,0x06,0xFF,0x03,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x50, // 0xD0    208   'Ð'
+  0xF0,0xF0,0xF0,0x44,0x44,0xF0,0x77,0x34,0xF0,0x7E,0xF0,0x6E,0xF0,0x74,0x37,0xF0,0x74,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x66,0xF0,0x25,0x86,0xF0,0x25,0x87,0xF0,0x15,0x88,0xF5,0x88,0xF5,0x89,0xE5,0x8A,0xD5,0x8A,0xD5,0x8B,0xC5,0x85,0x15,0xC5,0x85,0x16,0xB5,0x85,0x26,0xA5,0x85,0x26,0xA5,0x85,0x36,0x95,0x85,0x46,0x85,0x85,0x46,0x85,0x85,0x56,0x75,0x85,0x66,0x65,0x85,0x66,0x65,0x85,0x76,0x55,0x85,0x86,0x45,0x85,0x86,0x45,0x85,0x96,0x35,0x85,0xA6,0x25,0x85,0xA6,0x25,0x85,0xB6,0x15,0x85,0xC5,0x15,0x85,0xCB,0x85,0xDA,0x85,0xDA,0x85,0xE9,0x85,0xF8,0x85,0xF8,0x85,0xF0,0x17,0x85,0xF0,0x26,0x85,0xF0,0x26,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA0, // 0xD1    209   'Ñ'
+  0xE6,0xF0,0xF0,0x46,0xF0,0xF0,0x45,0xF0,0xF0,0x55,0xF0,0xF0,0x54,0xF0,0xF0,0x63,0xF0,0xF0,0x73,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x49,0xF0,0xCE,0xF0,0x9F,0x02,0xF0,0x5F,0x06,0xF0,0x28,0x78,0xF7,0xB7,0xE6,0xD6,0xD6,0xF6,0xB6,0xF0,0x26,0xA5,0xF0,0x45,0x95,0xF0,0x56,0x85,0xF0,0x65,0x85,0xF0,0x65,0x85,0xF0,0x65,0x75,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x75,0xF0,0x65,0x85,0xF0,0x65,0x85,0xF0,0x65,0x86,0xF0,0x46,0x95,0xF0,0x45,0xA6,0xF0,0x26,0xB6,0xF6,0xD6,0xD6,0xE7,0xB7,0xF8,0x78,0xF0,0x2F,0x06,0xF0,0x5F,0x02,0xF0,0x9D,0xF0,0xD8,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x10, // 0xD2    210   'Ò'
+  0xF0,0x56,0xF0,0xF0,0x26,0xF0,0xF0,0x35,0xF0,0xF0,0x35,0xF0,0xF0,0x44,0xF0,0xF0,0x53,0xF0,0xF0,0x53,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x79,0xF0,0xCE,0xF0,0x9F,0x02,0xF0,0x5F,0x06,0xF0,0x28,0x78,0xF7,0xB7,0xE6,0xD6,0xD6,0xF6,0xB6,0xF0,0x26,0xA5,0xF0,0x45,0x95,0xF0,0x56,0x85,0xF0,0x65,0x85,0xF0,0x65,0x85,0xF0,0x65,0x75,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x75,0xF0,0x65,0x85,0xF0,0x65,0x85,0xF0,0x65,0x86,0xF0,0x46,0x95,0xF0,0x45,0xA6,0xF0,0x26,0xB6,0xF6,0xD6,0xD6,0xE7,0xB7,0xF8,0x78,0xF0,0x2F,0x06,0xF0,0x5F,0x02,0xF0,0x9D,0xF0,0xD8,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x10, // 0xD3    211   'Ó'
+  0xF0,0x14,0xF0,0xF0,0x46,0xF0,0xF0,0x28,0xF0,0xF0,0x13,0x23,0xF0,0xF4,0x24,0xF0,0xE3,0x44,0xF0,0xC4,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x39,0xF0,0xCE,0xF0,0x9F,0x02,0xF0,0x5F,0x06,0xF0,0x28,0x78,0xF7,0xB7,0xE6,0xD6,0xD6,0xF6,0xB6,0xF0,0x26,0xA5,0xF0,0x45,0x95,0xF0,0x56,0x85,0xF0,0x65,0x85,0xF0,0x65,0x85,0xF0,0x65,0x75,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x75,0xF0,0x65,0x85,0xF0,0x65,0x85,0xF0,0x65,0x86,0xF0,0x46,0x95,0xF0,0x45,0xA6,0xF0,0x26,0xB6,0xF6,0xD6,0xD6,0xE7,0xB7,0xF8,0x78,0xF0,0x2F,0x06,0xF0,0x5F,0x02,0xF0,0x9D,0xF0,0xD8,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x10, // 0xD4    212   'Ô'
+  0xF0,0xF0,0xF0,0x94,0x44,0xF0,0xA7,0x34,0xF0,0xAE,0xF0,0x9E,0xF0,0xA4,0x37,0xF0,0xA4,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x39,0xF0,0xCE,0xF0,0x9F,0x02,0xF0,0x5F,0x06,0xF0,0x28,0x78,0xF7,0xB7,0xE6,0xD6,0xD6,0xF6,0xB6,0xF0,0x26,0xA5,0xF0,0x45,0x95,0xF0,0x56,0x85,0xF0,0x65,0x85,0xF0,0x65,0x85,0xF0,0x65,0x75,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x75,0xF0,0x65,0x85,0xF0,0x65,0x85,0xF0,0x65,0x86,0xF0,0x46,0x95,0xF0,0x45,0xA6,0xF0,0x26,0xB6,0xF6,0xD6,0xD6,0xE7,0xB7,0xF8,0x78,0xF0,0x2F,0x06,0xF0,0x5F,0x02,0xF0,0x9D,0xF0,0xD8,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x10, // 0xD5    213   'Õ'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB4,0x44,0xF0,0xC4,0x44,0xF0,0xC4,0x44,0xF0,0xC4,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x19,0xF0,0xCE,0xF0,0x9F,0x02,0xF0,0x5F,0x06,0xF0,0x28,0x78,0xF7,0xB7,0xE6,0xD6,0xD6,0xF6,0xB6,0xF0,0x26,0xA5,0xF0,0x45,0x95,0xF0,0x56,0x85,0xF0,0x65,0x85,0xF0,0x65,0x85,0xF0,0x65,0x75,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x65,0xF0,0x85,0x75,0xF0,0x65,0x85,0xF0,0x65,0x85,0xF0,0x65,0x86,0xF0,0x46,0x95,0xF0,0x45,0xA6,0xF0,0x26,0xB6,0xF6,0xD6,0xD6,0xE7,0xB7,0xF8,0x78,0xF0,0x2F,0x06,0xF0,0x5F,0x02,0xF0,0x9D,0xF0,0xD8,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x10, // 0xD6    214   'Ö'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x32,0xE1,0xC3,0xC3,0xA5,0xA5,0x96,0x86,0xA6,0x66,0xC6,0x46,0xE6,0x26,0xF0,0x1C,0xF0,0x3A,0xF0,0x58,0xF0,0x76,0xF0,0x78,0xF0,0x5A,0xF0,0x3C,0xF0,0x16,0x26,0xE6,0x46,0xC6,0x66,0xA6,0x86,0x95,0xA5,0xA3,0xC3,0xC1,0xE1,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0xD7    215   '×'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x69,0xF0,0xDD,0x72,0xFF,0x02,0x45,0xBF,0x05,0x25,0xB8,0x7C,0xB7,0xB9,0xC6,0xD7,0xC6,0xF6,0xB6,0xF0,0x17,0xA5,0xF0,0x18,0x96,0xFA,0x85,0xF5,0x15,0x85,0xE5,0x25,0x85,0xD5,0x44,0x75,0xE5,0x45,0x65,0xD5,0x55,0x65,0xC5,0x65,0x65,0xB5,0x75,0x65,0xA5,0x85,0x65,0x95,0x95,0x65,0x85,0xA5,0x65,0x85,0xA5,0x65,0x75,0xB5,0x65,0x65,0xC5,0x66,0x45,0xC6,0x75,0x35,0xD5,0x85,0x25,0xE5,0x86,0x14,0xE6,0x9A,0xE5,0xA9,0xE6,0xB7,0xE6,0xC7,0xD7,0xC8,0xB7,0xCB,0x78,0xDF,0x0A,0xD5,0x2F,0x02,0xE5,0x5E,0xF0,0x13,0x89,0xF0,0x51,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x90, // 0xD8    216   'Ø'
+  0xC6,0xF0,0xF0,0x16,0xF0,0xF0,0x15,0xF0,0xF0,0x25,0xF0,0xF0,0x24,0xF0,0xF0,0x33,0xF0,0xF0,0x43,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x75,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x95,0xF0,0x15,0xA5,0xF0,0x15,0xA5,0xF0,0x15,0xA6,0xE5,0xC6,0xC6,0xD7,0x87,0xFF,0x05,0xF0,0x2F,0x03,0xF0,0x4F,0xF0,0x9A,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD0, // 0xD9    217   'Ù'
+  0xF0,0x36,0xF0,0xE6,0xF0,0xF5,0xF0,0xF5,0xF0,0xF0,0x14,0xF0,0xF0,0x23,0xF0,0xF0,0x23,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA5,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x95,0xF0,0x15,0xA5,0xF0,0x15,0xA5,0xF0,0x15,0xA6,0xE5,0xC6,0xC6,0xD7,0x87,0xFF,0x05,0xF0,0x2F,0x03,0xF0,0x4F,0xF0,0x9A,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD0, // 0xDA    218   'Ú'
+  0xF0,0x14,0xF0,0xF0,0x16,0xF0,0xE8,0xF0,0xD3,0x23,0xF0,0xC4,0x24,0xF0,0xA4,0x44,0xF0,0x94,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x45,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x95,0xF0,0x15,0xA5,0xF0,0x15,0xA5,0xF0,0x15,0xA6,0xE5,0xC6,0xC6,0xD7,0x87,0xFF,0x05,0xF0,0x2F,0x03,0xF0,0x4F,0xF0,0x9A,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD0, // 0xDB    219   'Û'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF4,0x44,0xF0,0x94,0x44,0xF0,0x94,0x44,0xF0,0x94,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x45,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x85,0xF0,0x35,0x95,0xF0,0x15,0xA5,0xF0,0x15,0xA5,0xF0,0x15,0xA6,0xE5,0xC6,0xC6,0xD7,0x87,0xFF,0x05,0xF0,0x2F,0x03,0xF0,0x4F,0xF0,0x9A,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD0, // 0xDC    220   'Ü'
+  0xF0,0x26,0xF0,0xB6,0xF0,0xC5,0xF0,0xC5,0xF0,0xD4,0xF0,0xE3,0xF0,0xE3,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA6,0xF0,0x66,0x16,0xF0,0x46,0x36,0xF0,0x26,0x46,0xF0,0x26,0x56,0xF6,0x76,0xD6,0x86,0xD6,0x96,0xB6,0xB6,0x96,0xC6,0x96,0xD6,0x76,0xF6,0x56,0xF0,0x16,0x56,0xF0,0x26,0x36,0xF0,0x46,0x16,0xF0,0x56,0x16,0xF0,0x6B,0xF0,0x89,0xF0,0x99,0xF0,0xA7,0xF0,0xC5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x20, // 0xDD    221   'Ý'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x45,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xDF,0x05,0xDF,0x07,0xBF,0x09,0x9F,0x0A,0x85,0xD7,0x85,0xF6,0x75,0xF0,0x15,0x75,0xF0,0x16,0x65,0xF0,0x25,0x65,0xF0,0x25,0x65,0xF0,0x25,0x65,0xF0,0x25,0x65,0xF0,0x25,0x65,0xF0,0x25,0x65,0xF0,0x15,0x75,0xF0,0x15,0x75,0xF6,0x75,0xD7,0x8F,0x09,0x9F,0x08,0xAF,0x07,0xBF,0x04,0xE5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xD5,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC0, // 0xDE    222   'Þ'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x68,0xF0,0x6C,0xF0,0x2F,0xFF,0x02,0xD7,0x65,0xD5,0x95,0xC4,0xB4,0xB5,0xB4,0xB4,0xC4,0xB4,0xB5,0xB4,0xB4,0xC4,0xA5,0xC4,0xA4,0xD4,0x95,0xD4,0x94,0xE4,0x85,0xE4,0x84,0xF4,0x84,0xF4,0x85,0xE4,0x95,0xD4,0x97,0xB4,0xB6,0xA4,0xC7,0x84,0xE6,0x74,0xF5,0x74,0xF0,0x15,0x64,0xF0,0x24,0x64,0xF0,0x24,0x64,0x61,0xA4,0x64,0x44,0x94,0x64,0x36,0x75,0x64,0x46,0x46,0x74,0x5F,0x74,0x6D,0x84,0x7B,0x94,0x97,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0xDF    223   'ß'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x66,0xF0,0x86,0xF0,0x85,0xF0,0x95,0xF0,0x94,0xF0,0xA3,0xF0,0xB3,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE9,0xF0,0x2E,0xCF,0x02,0xAF,0x04,0x87,0x76,0x85,0xB5,0x65,0xD4,0x65,0xD4,0x82,0xE4,0xF0,0x94,0xF0,0x76,0xF0,0x1C,0xBF,0x02,0x8F,0x05,0x7F,0x24,0x6A,0x84,0x65,0xD4,0x55,0xE4,0x54,0xF4,0x54,0xE5,0x54,0xD6,0x55,0xB7,0x66,0x6A,0x6F,0x07,0x7F,0x01,0x14,0x8D,0x35,0x99,0x64,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA0, // 0xE0    224   'à'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC6,0xF0,0x66,0xF0,0x75,0xF0,0x75,0xF0,0x84,0xF0,0x93,0xF0,0x93,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x29,0xF0,0x2E,0xCF,0x02,0xAF,0x04,0x87,0x76,0x85,0xB5,0x65,0xD4,0x65,0xD4,0x82,0xE4,0xF0,0x94,0xF0,0x76,0xF0,0x1C,0xBF,0x02,0x8F,0x05,0x7F,0x24,0x6A,0x84,0x65,0xD4,0x55,0xE4,0x54,0xF4,0x54,0xE5,0x54,0xD6,0x55,0xB7,0x66,0x6A,0x6F,0x07,0x7F,0x01,0x14,0x8D,0x35,0x99,0x64,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA0, // 0xE1    225   'á'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x95,0xF0,0x76,0xF0,0x73,0x13,0xF0,0x54,0x14,0xF0,0x43,0x33,0xF0,0x34,0x34,0xF0,0x14,0x54,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB9,0xF0,0x2E,0xCF,0x02,0xAF,0x04,0x87,0x76,0x85,0xB5,0x65,0xD4,0x65,0xD4,0x82,0xE4,0xF0,0x94,0xF0,0x76,0xF0,0x1C,0xBF,0x02,0x8F,0x05,0x7F,0x24,0x6A,0x84,0x65,0xD4,0x55,0xE4,0x54,0xF4,0x54,0xE5,0x54,0xD6,0x55,0xB7,0x66,0x6A,0x6F,0x07,0x7F,0x01,0x14,0x8D,0x35,0x99,0x64,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA0, // 0xE2    226   'â'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x54,0x44,0xE7,0x34,0xEE,0xDE,0xE4,0x37,0xE4,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD9,0xF0,0x2E,0xCF,0x02,0xAF,0x04,0x87,0x76,0x85,0xB5,0x65,0xD4,0x65,0xD4,0x82,0xE4,0xF0,0x94,0xF0,0x76,0xF0,0x1C,0xBF,0x02,0x8F,0x05,0x7F,0x24,0x6A,0x84,0x65,0xD4,0x55,0xE4,0x54,0xF4,0x54,0xE5,0x54,0xD6,0x55,0xB7,0x66,0x6A,0x6F,0x07,0x7F,0x01,0x14,0x8D,0x35,0x99,0x64,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA0, // 0xE3    227   'ã'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF4,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB9,0xF0,0x2E,0xCF,0x02,0xAF,0x04,0x87,0x76,0x85,0xB5,0x65,0xD4,0x65,0xD4,0x82,0xE4,0xF0,0x94,0xF0,0x76,0xF0,0x1C,0xBF,0x02,0x8F,0x05,0x7F,0x24,0x6A,0x84,0x65,0xD4,0x55,0xE4,0x54,0xF4,0x54,0xE5,0x54,0xD6,0x55,0xB7,0x66,0x6A,0x6F,0x07,0x7F,0x01,0x14,0x8D,0x35,0x99,0x64,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA0, // 0xE4    228   'ä'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD5,0xF0,0x77,0xF0,0x53,0x32,0xF0,0x52,0x52,0xF0,0x42,0x52,0xF0,0x42,0x52,0xF0,0x43,0x33,0xF0,0x57,0xF0,0x75,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF9,0xF0,0x2E,0xCF,0x02,0xAF,0x04,0x87,0x76,0x85,0xB5,0x65,0xD4,0x65,0xD4,0x82,0xE4,0xF0,0x94,0xF0,0x76,0xF0,0x1C,0xBF,0x02,0x8F,0x05,0x7F,0x24,0x6A,0x84,0x65,0xD4,0x55,0xE4,0x54,0xF4,0x54,0xE5,0x54,0xD6,0x55,0xB7,0x66,0x6A,0x6F,0x07,0x7F,0x01,0x14,0x8D,0x35,0x99,0x64,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA0, // 0xE5    229   'å'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x69,0x97,0xF0,0x1E,0x5B,0xDF,0x01,0x2F,0xAF,0x0F,0x05,0x86,0x8B,0x65,0x84,0xB8,0x95,0x65,0xC6,0xB5,0x54,0xD5,0xD4,0xF0,0x75,0xD4,0xF0,0x56,0xF4,0xDC,0xF4,0x9F,0x0F,0x05,0x7F,0x0F,0x07,0x5E,0x2F,0x08,0x59,0x7F,0x08,0x46,0xB4,0xF0,0x75,0xD4,0xF0,0x74,0xE4,0xF1,0x64,0xD5,0xF4,0x34,0xD6,0xD4,0x44,0xC8,0xB5,0x45,0xAA,0x96,0x56,0x66,0x17,0x66,0x6F,0x02,0x3F,0x02,0x8F,0x5F,0xAC,0x8D,0xD8,0xD7,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD0, // 0xE6    230   'æ'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x57,0xF0,0x1C,0xBF,0x9F,0x02,0x77,0x57,0x65,0x95,0x55,0xB5,0x44,0xC5,0x44,0xD2,0x54,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF0,0x64,0xF2,0x54,0xE4,0x34,0xD5,0x35,0xC4,0x55,0xA5,0x57,0x66,0x7F,0x03,0x8F,0xCC,0xF8,0xF0,0x33,0xF0,0x73,0xF0,0x64,0xF0,0x67,0xF0,0x65,0xF0,0x64,0xF0,0x55,0xEA,0xF9,0xF0,0x17,0xF0,0xF0,0x60, // 0xE7    231   'ç'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x56,0xF0,0x86,0xF0,0x85,0xF0,0x95,0xF0,0x94,0xF0,0xA3,0xF0,0xB3,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF8,0xF0,0x3C,0xFF,0xBF,0x03,0xA6,0x66,0x95,0xA5,0x75,0xC5,0x64,0xE4,0x64,0xE4,0x54,0xF0,0x14,0x44,0xF0,0x14,0x4F,0x09,0x4F,0x09,0x4F,0x09,0x4F,0x09,0x44,0xF0,0x94,0xF0,0x94,0xF0,0xA4,0xF2,0x74,0xE5,0x55,0xC5,0x75,0xA6,0x77,0x76,0x9F,0x03,0xBF,0x01,0xED,0xF0,0x29,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x20, // 0xE8    232   'è'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB6,0xF0,0x66,0xF0,0x75,0xF0,0x75,0xF0,0x84,0xF0,0x93,0xF0,0x93,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x38,0xF0,0x3C,0xFF,0xBF,0x03,0xA6,0x66,0x95,0xA5,0x75,0xC5,0x64,0xE4,0x64,0xE4,0x54,0xF0,0x14,0x44,0xF0,0x14,0x4F,0x09,0x4F,0x09,0x4F,0x09,0x4F,0x09,0x44,0xF0,0x94,0xF0,0x94,0xF0,0xA4,0xF2,0x74,0xE5,0x55,0xC5,0x75,0xA6,0x77,0x76,0x9F,0x03,0xBF,0x01,0xED,0xF0,0x29,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x20, // 0xE9    233   'é'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x95,0xF0,0x76,0xF0,0x73,0x13,0xF0,0x54,0x14,0xF0,0x43,0x33,0xF0,0x34,0x34,0xF0,0x14,0x54,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB8,0xF0,0x3C,0xFF,0xBF,0x03,0xA6,0x66,0x95,0xA5,0x75,0xC5,0x64,0xE4,0x64,0xE4,0x54,0xF0,0x14,0x44,0xF0,0x14,0x4F,0x09,0x4F,0x09,0x4F,0x09,0x4F,0x09,0x44,0xF0,0x94,0xF0,0x94,0xF0,0xA4,0xF2,0x74,0xE5,0x55,0xC5,0x75,0xA6,0x77,0x76,0x9F,0x03,0xBF,0x01,0xED,0xF0,0x29,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x20, // 0xEA    234   'ê'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF4,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB8,0xF0,0x3C,0xFF,0xBF,0x03,0xA6,0x66,0x95,0xA5,0x75,0xC5,0x64,0xE4,0x64,0xE4,0x54,0xF0,0x14,0x44,0xF0,0x14,0x4F,0x09,0x4F,0x09,0x4F,0x09,0x4F,0x09,0x44,0xF0,0x94,0xF0,0x94,0xF0,0xA4,0xF2,0x74,0xE5,0x55,0xC5,0x75,0xA6,0x77,0x76,0x9F,0x03,0xBF,0x01,0xED,0xF0,0x29,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x20, // 0xEB    235   'ë'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x76,0x96,0x95,0xA5,0xA4,0xB3,0xC3,0xF0,0xF0,0xF0,0xF0,0x54,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x90, // 0xEC    236   'ì'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD6,0x76,0x85,0x85,0x94,0xA3,0xA3,0xF0,0xF0,0xF0,0xF0,0x84,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x90, // 0xED    237   'í'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xA4,0x96,0x78,0x63,0x23,0x54,0x24,0x34,0x44,0x24,0x44,0xF0,0xF0,0xF0,0xF0,0x34,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x90, // 0xEE    238   'î'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x44,0x44,0x24,0x44,0x24,0x44,0x24,0x44,0xF0,0xF0,0xF0,0xF0,0x24,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x90, // 0xEF    239   'ï'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x36,0x71,0xF6,0x34,0xF0,0x2C,0xF0,0x28,0xF0,0x48,0xF0,0x3A,0xF0,0x16,0x25,0xF4,0x55,0xE2,0x85,0xF0,0x85,0xF0,0x16,0x25,0xDF,0xBF,0x03,0x9F,0x04,0x87,0x68,0x75,0xA6,0x65,0xC5,0x64,0xE4,0x55,0xE5,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF5,0x45,0xE4,0x64,0xE4,0x65,0xC5,0x75,0xA5,0x87,0x66,0xAF,0x03,0xBF,0x01,0xEC,0xF0,0x38,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0xF0    240   'ð'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x54,0x44,0xE7,0x34,0xEE,0xDE,0xE4,0x37,0xE4,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF7,0xC4,0x3C,0x94,0x2E,0x84,0x1F,0x01,0x79,0x66,0x77,0x95,0x76,0xB5,0x65,0xD4,0x65,0xD4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB0, // 0xF1    241   'ñ'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x56,0xF0,0x86,0xF0,0x85,0xF0,0x95,0xF0,0x94,0xF0,0xA3,0xF0,0xB3,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF8,0xF0,0x3C,0xEF,0x01,0xBF,0x03,0x97,0x66,0x95,0xA5,0x75,0xC5,0x64,0xE4,0x64,0xE4,0x55,0xE5,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x45,0xE5,0x54,0xE4,0x64,0xE4,0x65,0xC5,0x75,0xA5,0x87,0x67,0x9F,0x03,0xBF,0x01,0xEC,0xF0,0x38,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0xF2    242   'ò'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB6,0xF0,0x66,0xF0,0x75,0xF0,0x75,0xF0,0x84,0xF0,0x93,0xF0,0x93,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x38,0xF0,0x3C,0xEF,0x01,0xBF,0x03,0x97,0x66,0x95,0xA5,0x75,0xC5,0x64,0xE4,0x64,0xE4,0x55,0xE5,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x45,0xE5,0x54,0xE4,0x64,0xE4,0x65,0xC5,0x75,0xA5,0x87,0x67,0x9F,0x03,0xBF,0x01,0xEC,0xF0,0x38,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0xF3    243   'ó'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x95,0xF0,0x76,0xF0,0x73,0x13,0xF0,0x54,0x14,0xF0,0x43,0x33,0xF0,0x34,0x34,0xF0,0x14,0x54,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB8,0xF0,0x3C,0xEF,0x01,0xBF,0x03,0x97,0x66,0x95,0xA5,0x75,0xC5,0x64,0xE4,0x64,0xE4,0x55,0xE5,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x45,0xE5,0x54,0xE4,0x64,0xE4,0x65,0xC5,0x75,0xA5,0x87,0x67,0x9F,0x03,0xBF,0x01,0xEC,0xF0,0x38,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0xF4    244   'ô'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x54,0x44,0xE7,0x34,0xEE,0xDE,0xE4,0x37,0xE4,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD8,0xF0,0x3C,0xEF,0x01,0xBF,0x03,0x97,0x66,0x95,0xA5,0x75,0xC5,0x64,0xE4,0x64,0xE4,0x55,0xE5,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x45,0xE5,0x54,0xE4,0x64,0xE4,0x65,0xC5,0x75,0xA5,0x87,0x67,0x9F,0x03,0xBF,0x01,0xEC,0xF0,0x38,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0xF5    245   'õ'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF4,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB8,0xF0,0x3C,0xEF,0x01,0xBF,0x03,0x97,0x66,0x95,0xA5,0x75,0xC5,0x64,0xE4,0x64,0xE4,0x55,0xE5,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x45,0xE5,0x54,0xE4,0x64,0xE4,0x65,0xC5,0x75,0xA5,0x87,0x67,0x9F,0x03,0xBF,0x01,0xEC,0xF0,0x38,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30, // 0xF6    246   'ö'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x34,0xF0,0x84,0xF0,0x84,0xF0,0x84,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x4F,0x09,0x3F,0x09,0x3F,0x09,0x3F,0x09,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x44,0xF0,0x84,0xF0,0x84,0xF0,0x84,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x80, // 0xF7    247   '÷'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC2,0xF0,0x19,0x34,0xDF,0x03,0xBF,0x04,0xBF,0x05,0xA7,0x67,0xB5,0x97,0x95,0x99,0x84,0x9A,0x84,0x94,0x24,0x75,0x85,0x25,0x64,0x85,0x44,0x64,0x75,0x54,0x64,0x65,0x64,0x64,0x55,0x74,0x64,0x54,0x84,0x64,0x45,0x84,0x64,0x35,0x94,0x64,0x25,0x95,0x64,0x15,0xA4,0x88,0xA5,0x88,0xA5,0x87,0x96,0x97,0x77,0xAF,0x05,0xAF,0x05,0xB4,0x2D,0xD3,0x48,0xF0,0x21,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x50, // 0xF8    248   'ø'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x46,0xF0,0x86,0xF0,0x85,0xF0,0x95,0xF0,0x94,0xF0,0xA3,0xF0,0xB3,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x74,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xD5,0x64,0xD5,0x65,0xB6,0x66,0x97,0x76,0x69,0x7F,0x01,0x14,0x8E,0x24,0x9C,0x34,0xC7,0x54,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB0, // 0xF9    249   'ù'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xC6,0xF0,0x66,0xF0,0x75,0xF0,0x75,0xF0,0x84,0xF0,0x93,0xF0,0x93,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x84,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xD5,0x64,0xD5,0x65,0xB6,0x66,0x97,0x76,0x69,0x7F,0x01,0x14,0x8E,0x24,0x9C,0x34,0xC7,0x54,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB0, // 0xFA    250   'ú'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x94,0xF0,0x86,0xF0,0x68,0xF0,0x53,0x23,0xF0,0x44,0x24,0xF0,0x24,0x44,0xF0,0x14,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x34,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xD5,0x64,0xD5,0x65,0xB6,0x66,0x97,0x76,0x69,0x7F,0x01,0x14,0x8E,0x24,0x9C,0x34,0xC7,0x54,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB0, // 0xFB    251   'û'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD4,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0x14,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x44,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xE4,0x64,0xD5,0x64,0xD5,0x65,0xB6,0x66,0x97,0x76,0x69,0x7F,0x01,0x14,0x8E,0x24,0x9C,0x34,0xC7,0x54,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xB0, // 0xFC    252   'ü'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD6,0xF0,0x36,0xF0,0x45,0xF0,0x45,0xF0,0x54,0xF0,0x63,0xF0,0x63,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x84,0xF4,0x34,0xD5,0x34,0xD4,0x44,0xD4,0x54,0xB4,0x64,0xB4,0x65,0x95,0x74,0x94,0x84,0x94,0x85,0x75,0x94,0x74,0xA4,0x74,0xA5,0x54,0xC4,0x54,0xC4,0x45,0xC5,0x34,0xE4,0x34,0xE4,0x25,0xE5,0x14,0xF0,0x19,0xF0,0x18,0xF0,0x28,0xF0,0x37,0xF0,0x36,0xF0,0x55,0xF0,0x54,0xF0,0x64,0xF0,0x55,0xF0,0x54,0xF0,0x64,0xF0,0x54,0xF0,0x55,0xF9,0xF0,0x19,0xF0,0x27,0xF0,0x35,0xF0,0xF0,0xC0, // 0xFD    253   'ý'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xD4,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0x47,0xD4,0x2B,0xB4,0x1E,0x9F,0x05,0x89,0x57,0x77,0x95,0x76,0xB5,0x65,0xD4,0x65,0xD4,0x64,0xE5,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xF4,0x54,0xE5,0x54,0xE4,0x65,0xD4,0x66,0xB4,0x77,0x95,0x79,0x56,0x8F,0x04,0x94,0x1D,0xA4,0x2B,0xB4,0x47,0xD4,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0x94,0xF0,0xF0,0xF0,0x40, // 0xFE    254   'þ'
+  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x74,0x44,0xD4,0x44,0xD4,0x44,0xD4,0x44,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x24,0xF4,0x34,0xD5,0x34,0xD4,0x44,0xD4,0x54,0xB4,0x64,0xB4,0x65,0x95,0x74,0x94,0x84,0x94,0x85,0x75,0x94,0x74,0xA4,0x74,0xA5,0x54,0xC4,0x54,0xC4,0x45,0xC5,0x34,0xE4,0x34,0xE4,0x25,0xE5,0x14,0xF0,0x19,0xF0,0x18,0xF0,0x28,0xF0,0x37,0xF0,0x36,0xF0,0x55,0xF0,0x54,0xF0,0x64,0xF0,0x55,0xF0,0x54,0xF0,0x64,0xF0,0x54,0xF0,0x55,0xF9,0xF0,0x19,0xF0,0x27,0xF0,0x35,0xF0,0xF0,0xC0, // 0xFF    255   'ÿ'
+};
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * Converts a 16BPP µGUI bitmap with up to 256 colors to an indexed bitmap (BMP_BPP_1/2/4/8 with a palette).
+ *
+ * Host tool, build it with the bitmap to convert and redirect the output to a new file:
+ *   gcc -I.. -I../../LCD -DBMP=fry ugui_bmp_index.c ../../LCD/images.c -o ugui_bmp_index
+ *   ./ugui_bmp_index fry_idx > fry_idx.c
+ *
+ * The smallest depth holding every color is used. See ugui.h for the pixel packing.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "ugui.h"
+
+#ifndef BMP
+#error Define BMP to the bitmap to convert, ex. -DBMP=fry
+#endif
+
+extern UG_BMP BMP;
+
+int main(int argc, char **argv)
+{
+  const uint16_t *p = BMP.p;
+  uint16_t palette[256];
+  uint32_t colors = 0, bpp, stride, size, i, x, y;
+  uint8_t *out;
+
+  if(argc<2){
+    fprintf(stderr, "usage: %s <name>, ex. fry_idx\n", argv[0]);
+    return 1;
+  }
+  if(BMP.bpp!=BMP_BPP_16 || (BMP.colors & BMP_RLE)){
+    fprintf(stderr, "Only raw 16BPP bitmaps can be converted\n");
+    return 1;
+  }
+
+  for(i=0; i<(uint32_t)BMP.width*BMP.height; i++){
+    uint32_t c;
+    for(c=0; c<colors && palette[c]!=p[i]; c++);
+    if(c==colors){
+      if(colors==256){
+        fprintf(stderr, "More than 256 colors\n");
+        return 1;
+      }
+      palette[colors++] = p[i];
+    }
+  }
+  for(bpp=1; (1u<<bpp)<colors; bpp<<=1);
+
+  stride = (BMP.width*bpp+7)/8;
+  size = stride*BMP.height;
+  out = calloc(size, 1);
+  for(y=0; y<BMP.height; y++){
+    for(x=0; x<BMP.width; x++){
+      uint32_t c, bit = x*bpp;
+      for(c=0; palette[c]!=p[x+y*BMP.width]; c++);
+      out[y*stride + bit/8] |= c << (8-bpp-bit%8);
+    }
+  }
+
+  printf("// Indexed by ugui_bmp_index, %u colors, %u bytes from %u\n\n", colors, size, BMP.width*BMP.height*2);
+  printf("#include \"ugui.h\"\n\n");
+  printf("const uint16_t %s_palette[%u] = {\n", argv[1], colors);
+  for(i=0; i<colors; i++){
+    printf("%s0x%04x,%s", i%16 ? " " : "    ", palette[i], (i%16==15 || i==colors-1) ? "\n" : "");
+  }
+  printf("};\n\n");
+  printf("const uint8_t %s_data[%u] = {\n", argv[1], size);
+  for(i=0; i<size; i++){
+    printf("%s0x%02x,%s", i%16 ? " " : "    ", out[i], (i%16==15 || i==size-1) ? "\n" : "");
+  }
+  printf("};\n\n");
+  printf("UG_BMP %s = {\n", argv[1]);
+  printf("  .p=%s_data,\n", argv[1]);
+  printf("  .width=%u,\n", BMP.width);
+  printf("  .height=%u,\n", BMP.height);
+  printf("  .bpp=BMP_BPP_%u,\n", bpp);
+  printf("  .colors=BMP_RGB565,\n");
+  printf("  .palette=%s_palette,\n", argv[1]);
+  printf("};\n");
+  return 0;
+}
@@ -0,0 +1,101 @@
+/*
+ * Converts a 16BPP µGUI bitmap to the run length encoded format (BMP_RLE).
+ *
+ * Host tool, build it with the bitmap to convert and redirect the output to a new file:
+ *   gcc -I.. -I../../LCD -DBMP=fry ugui_bmp_rle.c ../../LCD/images.c -o ugui_bmp_rle
+ *   ./ugui_bmp_rle fry_rle > fry_rle.c
+ *
+ * Runs of 3 or more equal pixels become run packets, anything else is stored as it is.
+ * See ugui.h for the packet format.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "ugui.h"
+
+#ifndef BMP
+#error Define BMP to the bitmap to convert, ex. -DBMP=fry
+#endif
+
+#define RLE_MIN_RUN   3                         // Shorter runs cost more as a packet than stored in a literal
+#define RLE_MAX       0x8000                    // Pixels per packet
+
+extern UG_BMP BMP;
+
+static uint16_t *out;
+static uint32_t out_size;
+
+static void put(uint16_t w)
+{
+  out = realloc(out, (out_size+1)*sizeof(uint16_t));
+  out[out_size++] = w;
+}
+
+static void put_literal(const uint16_t *p, uint32_t n)
+{
+  while(n){
+    uint32_t len = n>RLE_MAX ? RLE_MAX : n;
+    put(len-1);
+    for(uint32_t i=0; i<len; i++){
+      put(p[i]);
+    }
+    p += len;
+    n -= len;
+  }
+}
+
+static void put_run(uint16_t color, uint32_t n)
+{
+  while(n){
+    uint32_t len = n>RLE_MAX ? RLE_MAX : n;
+    put(0x8000 | (len-1));
+    put(color);
+    n -= len;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  const uint16_t *p = BMP.p;
+  uint32_t count = (uint32_t)BMP.width*BMP.height;
+  uint32_t i = 0, lit = 0;
+
+  if(argc<2){
+    fprintf(stderr, "usage: %s <name>, ex. fry_rle\n", argv[0]);
+    return 1;
+  }
+  if(BMP.bpp!=BMP_BPP_16 || (BMP.colors & BMP_RLE)){
+    fprintf(stderr, "Only raw 16BPP bitmaps can be encoded\n");
+    return 1;
+  }
+
+  while(i<count){
+    uint32_t n = 1;
+    while(i+n<count && p[i+n]==p[i]){
+      n++;
+    }
+    if(n>=RLE_MIN_RUN){
+      put_literal(&p[lit], i-lit);
+      put_run(p[i], n);
+      lit = i+n;
+    }
+    i += n;
+  }
+  put_literal(&p[lit], count-lit);
+
+  printf("// Run length encoded by ugui_bmp_rle, %u words from %u\n\n", out_size, count);
+  printf("#include \"ugui.h\"\n\n");
+  printf("const uint16_t %s_data[%u] = {\n", argv[1], out_size);
+  for(i=0; i<out_size; i++){
+    printf("%s0x%04x,%s", i%16 ? " " : "    ", out[i], (i%16==15 || i==out_size-1) ? "\n" : "");
+  }
+  printf("};\n\n");
+  printf("UG_BMP %s = {\n", argv[1]);
+  printf("  .p=%s_data,\n", argv[1]);
+  printf("  .width=%u,\n", BMP.width);
+  printf("  .height=%u,\n", BMP.height);
+  printf("  .bpp=BMP_BPP_16,\n");
+  printf("  .colors=BMP_RGB565 | BMP_RLE,\n");
+  printf("};\n");
+  return 0;
+}
@@ -0,0 +1,177 @@
+/*
+ * Converts a 1BPP µGUI font to the run length encoded format.
+ *
+ * Host tool, build it with the font to convert and redirect the output to a new font file:
+ *   gcc -I.. -DFONT=FONT_arial_49X57 ugui_font_rle.c ../Fonts/arial_49X57.c -o ugui_font_rle
+ *   ./ugui_font_rle arial_49X57_RLE > ../Fonts/arial_49X57_rle.c
+ *
+ * The header, width table and offset table are kept, bytes per char is set to 0 and flags bit 5 is set.
+ * See ugui.h for the glyph format.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "ugui.h"
+
+#ifndef FONT
+#error Define FONT to the font array to convert, ex. -DFONT=FONT_arial_49X57
+#endif
+
+extern UG_FONT FONT[];
+
+static uint8_t *out;
+static uint32_t out_size;
+
+static void put(uint8_t b)
+{
+  out = realloc(out, out_size+1);
+  out[out_size++] = b;
+}
+
+/* Background run followed by a foreground run, split in nibbles */
+static void put_runs(uint32_t bg, uint32_t fg)
+{
+  while(bg>15){
+    put(0xF0);
+    bg -= 15;
+  }
+  while(fg>15){
+    put((bg<<4) | 15);
+    bg = 0;
+    fg -= 15;
+  }
+  if(bg || fg){
+    put((bg<<4) | fg);
+  }
+}
+
+static void encode(const uint8_t *glyph, uint8_t width, uint8_t height, uint8_t actual_width)
+{
+  uint8_t bn = (width+7)/8;
+  uint32_t runs[2] = {0, 0};
+  uint8_t last = 0;
+
+  for(uint8_t y=0; y<height; y++){
+    for(uint8_t x=0; x<actual_width; x++){
+      uint8_t px = (glyph[y*bn + x/8] >> (x%8)) & 1;
+      if(!px && last){                          // Background after foreground closes a pair
+        put_runs(runs[0], runs[1]);
+        runs[0] = runs[1] = 0;
+      }
+      runs[px]++;
+      last = px;
+    }
+  }
+  put_runs(runs[0], runs[1]);
+}
+
+static void print_bytes(const uint8_t *p, uint32_t count, uint32_t per_line)
+{
+  for(uint32_t i=0; i<count; i++){
+    printf("%s0x%02X,%s", i%per_line ? "" : "  ", p[i], (i%per_line==per_line-1 || i==count-1) ? "\n" : "");
+  }
+}
+
+static void print_char(uint16_t c, uint8_t old)
+{
+  char utf8[4] = {0};
+  if(old || c<0x20 || c==0x7F){
+    printf(" // 0x%X\n", c);
+    return;
+  }
+  if(c<0x80){
+    utf8[0] = c;
+  }
+  else if(c<0x800){
+    utf8[0] = 0xC0 | (c>>6);
+    utf8[1] = 0x80 | (c&0x3F);
+  }
+  else{
+    utf8[0] = 0xE0 | (c>>12);
+    utf8[1] = 0x80 | ((c>>6)&0x3F);
+    utf8[2] = 0x80 | (c&0x3F);
+  }
+  printf(" // 0x%-6X%-6u'%s'\n", c, c, utf8);
+}
+
+int main(int argc, char **argv)
+{
+  const uint8_t *f = FONT;
+  uint8_t width = f[0], height = f[1], flags = f[8];
+  uint16_t chars = (f[2]<<8) | f[3];
+  uint16_t offset_size = (f[4]<<8) | f[5];
+  uint16_t bytes_per_char = (f[6]<<8) | f[7];
+  const uint8_t *widths = (flags & 0x40) ? f+9 : NULL;
+  const uint8_t *offsets = f + 9 + (widths ? chars : 0);
+  const uint8_t *data = offsets + offset_size;
+  uint32_t *start = calloc(chars+1, sizeof(uint32_t));
+  uint16_t *codes = calloc(chars, sizeof(uint16_t));
+
+  if(argc<2){
+    fprintf(stderr, "usage: %s <name>, ex. arial_49X57_RLE\n", argv[0]);
+    return 1;
+  }
+  if((flags & 0x3F) != FONT_TYPE_1BPP){
+    fprintf(stderr, "Only 1BPP fonts can be encoded\n");
+    return 1;
+  }
+
+  for(uint16_t i=0, n=0; offsets[i]!=0xFF && n<chars; ){ // Char codes, for the comments
+    uint16_t c0 = (offsets[i+1]<<8) | offsets[i+2], c1 = c0;
+    if(offsets[i]==1){
+      c1 = (offsets[i+3]<<8) | offsets[i+4];
+      i += 5;
+    }
+    else{
+      i += 3;
+    }
+    for(uint32_t c=c0; c<=c1 && n<chars; c++){
+      codes[n++] = c;
+    }
+  }
+
+  for(uint16_t i=0; i<chars; i++){
+    start[i] = out_size;
+    encode(data + i*bytes_per_char, width, height, widths ? widths[i] : width);
+  }
+  start[chars] = out_size;
+  if(out_size>0xFFFF){
+    fprintf(stderr, "Encoded data is over 64KB, split the font\n");
+    return 1;
+  }
+
+  printf("// Run length encoded by ugui_font_rle\n\n");
+  printf("/************************************************\n");
+  printf("Add this lines to ugui.h:\n");
+  printf("  #ifdef USE_FONT_%s\n", argv[1]);
+  printf("  extern UG_FONT FONT_%s[];\n", argv[1]);
+  printf("  #endif\n\n");
+  printf("To enable this font, add this line to ugui_config.h:\n");
+  printf("  #define UGUI_USE_FONT_%s\n", argv[1]);
+  printf("************************************************/\n\n");
+  printf("#include \"ugui.h\"\n");
+  printf("#ifdef UGUI_USE_FONT_%s\n\n", argv[1]);
+  printf("UG_FONT FONT_%s[] = {\n", argv[1]);
+  printf("  // Width, Height, Chars, Offsets size, Bytes per char, Flags\n");
+  printf("  0x%02X,0x%02X,0x%02X,0x%02X,0x%02X,0x%02X,0x00,0x00,0x%02X,\n", width, height, f[2], f[3], f[4], f[5], flags | 0x20);
+  if(widths){
+    printf("  // Widths\n");
+    print_bytes(widths, chars, 10);
+  }
+  printf("  // Offsets\n");
+  print_bytes(offsets, offset_size, offset_size);
+  printf("  // Glyph offsets\n");
+  for(uint16_t i=0; i<chars; i++){
+    printf("%s0x%02X,0x%02X,%s", i%8 ? "" : "  ", start[i]>>8, start[i]&0xFF, (i%8==7 || i==chars-1) ? "\n" : "");
+  }
+  printf("  // Glyphs\n");
+  for(uint16_t i=0; i<chars; i++){
+    printf("  ");
+    for(uint32_t j=start[i]; j<start[i+1]; j++){
+      printf("0x%02X,", out[j]);
+    }
+    print_char(codes[i], flags & 0x80);
+  }
+  printf("};\n\n#endif\n");
+  return 0;
+}
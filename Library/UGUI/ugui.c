@@ -21,8 +21,82 @@ static UG_RESULT _UG_WindowDrawTitle( UG_WINDOW* wnd );
 static void _UG_WindowUpdate( UG_WINDOW* wnd );
 static UG_RESULT _UG_WindowClear( UG_WINDOW* wnd );
 static void _UG_FontSelect( UG_FONT *font);
+static void _UG_FontIndex( void );
 static UG_S16 _UG_PutChar( UG_CHAR chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc);
+static void _UG_PutRun( UG_S16 x, UG_S16 y, UG_S16 w, UG_U16 pos, UG_U16 n, UG_COLOR c, UG_U8 fg, void(*push_pixels)(UG_SIZE, UG_COLOR) );
+
+typedef struct
+{
+   struct
+   {
+      const UG_U8* p;                           // Bitmap, or next run byte for RLE fonts
+      UG_S16 w;
+      UG_U8 bg;                                 // RLE runs left from the last byte
+      UG_U8 fg;
+   } glyph[UG_TEXT_LINE_CHARS];
+   UG_U8 count;
+   UG_S16 x;
+   UG_S16 y;
+   UG_S16 w;
+   UG_COLOR fc;
+   UG_COLOR bc;
+   void(*push_pixels)(UG_SIZE, UG_COLOR);
+   UG_COLOR color;                              // Pixels waiting to be pushed
+   UG_SIZE pixels;
+} _UG_LINE;
+
+typedef struct
+{
+   char* str;
+   UG_U16 sum;
+   UG_FONT* font;
+   UG_AREA a;
+   UG_S16 h_space;
+   UG_U8 lines;
+   struct
+   {
+      UG_U16 start;                             // Offsets in str
+      UG_U16 end;
+      UG_S16 width;
+   } line[UG_TEXT_LAYOUT_LINES];
+} _UG_LAYOUT;
+
+static UG_CHAR _UG_NextChar( char** str );
+static _UG_LAYOUT* _UG_TextLayout( UG_TEXT* txt );
+static UG_U8 _UG_LineMode( UG_S16 h_space );
+static void _UG_LineAdd( _UG_LINE* l, UG_CHAR chr, UG_S16 x, UG_S16 y );
+static void _UG_LineFlush( _UG_LINE* l );
 static UG_S16 _UG_GetCharData(UG_CHAR encoding,  const UG_U8 **p);
+
+typedef struct
+{
+   UG_SPAN span[UG_SPAN_BATCH];
+   UG_U8 count;
+} _UG_SPANS;
+
+static void _UG_SpanFlush( _UG_SPANS* s );
+static void _UG_SpanAdd( _UG_SPANS* s, UG_S16 y, UG_S16 xs, UG_S16 xe, UG_COLOR c );
+
+typedef struct
+{
+   UG_POINT p[UG_PIXEL_BATCH];
+   UG_U8 count;
+   UG_U8 clip;                                  // Primitive partly visible, check every pixel
+   UG_COLOR c;
+} _UG_PIXELS;
+
+static void _UG_PixelFlush( _UG_PIXELS* s );
+static void _UG_PixelAdd( _UG_PIXELS* s, UG_S16 x, UG_S16 y );
+
+/* Clip test results */
+#define _UG_CLIP_OUT                                  0
+#define _UG_CLIP_IN                                   1
+#define _UG_CLIP_PART                                 2
+
+static UG_U8 _UG_ClipTest( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye );
+static UG_U8 _UG_ClipArea( UG_S16* xs, UG_S16* ys, UG_S16* xe, UG_S16* ye );
+static void _UG_PSetClip( UG_S16 x, UG_S16 y, UG_COLOR c );
+static void(*_UG_FillArea( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye ))(UG_SIZE, UG_COLOR);
 #ifdef UGUI_USE_UTF8
 static UG_U16 _UG_DecodeUTF8(char **str);
 #endif
@@ -59,6 +133,8 @@ UG_S16 UG_Init( UG_GUI* g, UG_DEVICE *device )
    g->console.y_end = g->device->y_dim - g->console.x_start-1;
    g->console.x_pos = g->console.x_end;
    g->console.y_pos = g->console.y_end;
+   g->console.scroll_end = -1;
+   g->console.scroll = 0;
 #endif
    g->char_h_space = 1;
    g->char_v_space = 1;
@@ -72,12 +148,19 @@ UG_S16 UG_Init( UG_GUI* g, UG_DEVICE *device )
    g->currentFont.offsets = NULL;
    g->currentFont.data = NULL;
    g->currentFont.font = NULL;
+   g->currentFont.is_rle = 0;
+   g->currentFont.range_count = 0;
    g->desktop_color = C_DESKTOP_COLOR;
    g->fore_color = C_WHITE;
    g->back_color = C_BLACK;
    g->next_window = NULL;
    g->active_window = NULL;
    g->last_window = NULL;
+   g->clip.xs = 0;
+   g->clip.ys = 0;
+   g->clip.xe = g->device->x_dim - 1;
+   g->clip.ye = g->device->y_dim - 1;
+   g->clip_depth = 0;
 
    /* Clear drivers */
    for(i=0;i<NUMBER_OF_DRIVERS;i++)
@@ -101,6 +184,31 @@ UG_GUI* UG_GetGUI( void )
    return gui;
 }
 
+/*
+ * Limits drawing to an area, inside the current clip rectangle.
+ * Primitives are clipped once, drivers only get the visible part
+ */
+UG_RESULT UG_PushClip( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye )
+{
+   if ( gui->clip_depth == UG_CLIP_DEPTH ) return UG_RESULT_FAIL;
+   if ( xe < xs ) swap(xs,xe);
+   if ( ye < ys ) swap(ys,ye);
+   gui->clip_stack[gui->clip_depth++] = gui->clip;
+   if ( xs > gui->clip.xs ) gui->clip.xs = xs;
+   if ( ys > gui->clip.ys ) gui->clip.ys = ys;
+   if ( xe < gui->clip.xe ) gui->clip.xe = xe;
+   if ( ye < gui->clip.ye ) gui->clip.ye = ye;
+   return UG_RESULT_OK;                                     // Empty if they don't overlap, xs > xe or ys > ye
+}
+
+/* Restores the clip rectangle saved by the last UG_PushClip */
+UG_RESULT UG_PopClip( void )
+{
+   if ( !gui->clip_depth ) return UG_RESULT_FAIL;
+   gui->clip = gui->clip_stack[--gui->clip_depth];
+   return UG_RESULT_OK;
+}
+
 /*
  * Sets the GUI font
  */
@@ -122,6 +230,7 @@ void UG_FillFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
      swap(x1,x2);
    if ( y2 < y1 )
      swap(y1,y2);
+   if ( !_UG_ClipArea(&x1, &y1, &x2, &y2) ) return;
 
    /* Is hardware acceleration available? */
    if ( gui->driver[DRIVER_FILL_FRAME].state & DRIVER_ENABLED )
@@ -141,6 +250,7 @@ void UG_FillFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
 void UG_FillRoundFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_S16 r, UG_COLOR c )
 {
    UG_S16  x,y,xd;
+   _UG_SPANS s;
 
    if ( x2 < x1 )
      swap(x1,x2);
@@ -153,19 +263,16 @@ void UG_FillRoundFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_S16 r, UG
    x = 0;
    y = r;
 
-   UG_FillFrame(x1 + r, y1, x2 - r, y2, c);
+   UG_FillFrame(x1, y1 + r, x2, y2 - r, c);        // Full width between the corners, at r=1 only the 4 corner pixels stay empty
 
+   s.count = 0;
    while ( x <= y )
    {
-     if( y > 0 )
-     {
-        UG_DrawLine(x2 + x - r, y1 - y + r, x2+ x - r, y + y2 - r, c);
-        UG_DrawLine(x1 - x + r, y1 - y + r, x1- x + r, y + y2 - r, c);
-     }
+     /* Rows x pixels away from the corner centers, x changes every step */
      if( x > 0 )
      {
-        UG_DrawLine(x1 - y + r, y1 - x + r, x1 - y + r, x + y2 - r, c);
-        UG_DrawLine(x2 + y - r, y1 - x + r, x2 + y - r, x + y2 - r, c);
+        _UG_SpanAdd(&s, y1 + r - x, x1 + r - y, x2 - r + y, c);
+        _UG_SpanAdd(&s, y2 - r + x, x1 + r - y, x2 - r + y, c);
      }
      if ( xd < 0 )
      {
@@ -173,11 +280,18 @@ void UG_FillRoundFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_S16 r, UG
      }
      else
      {
+        /* Rows y pixels away, at their widest now that y changes */
+        if( y > x )
+        {
+           _UG_SpanAdd(&s, y1 + r - y, x1 + r - x, x2 - r + x, c);
+           _UG_SpanAdd(&s, y2 - r + y, x1 + r - x, x2 - r + x, c);
+        }
         xd += ((x - y) << 2) + 10;
         y--;
      }
      x++;
    }
+   _UG_SpanFlush(&s);
 }
 
 void UG_DrawMesh( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_U16 spacing, UG_COLOR c )
@@ -238,33 +352,36 @@ void UG_DrawRoundFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_S16 r, UG
 
 void UG_DrawPixel( UG_S16 x0, UG_S16 y0, UG_COLOR c )
 {
-   gui->device->pset(x0,y0,c);
+   _UG_PSetClip(x0,y0,c);
 }
 
 void UG_DrawCircle( UG_S16 x0, UG_S16 y0, UG_S16 r, UG_COLOR c )
 {
    UG_S16 x,y,xd,yd,e;
+   _UG_PIXELS s;
 
-   if ( x0<0 ) return;
-   if ( y0<0 ) return;
    if ( r<=0 ) return;
+   s.clip = _UG_ClipTest(x0 - r, y0 - r, x0 + r, y0 + r);
+   if ( s.clip == _UG_CLIP_OUT ) return;
 
    xd = 1 - (r << 1);
    yd = 0;
    e = 0;
    x = r;
    y = 0;
+   s.count = 0;
+   s.c = c;
 
    while ( x >= y )
    {
-      gui->device->pset(x0 - x, y0 + y, c);
-      gui->device->pset(x0 - x, y0 - y, c);
-      gui->device->pset(x0 + x, y0 + y, c);
-      gui->device->pset(x0 + x, y0 - y, c);
-      gui->device->pset(x0 - y, y0 + x, c);
-      gui->device->pset(x0 - y, y0 - x, c);
-      gui->device->pset(x0 + y, y0 + x, c);
-      gui->device->pset(x0 + y, y0 - x, c);
+      _UG_PixelAdd(&s, x0 - x, y0 + y);
+      _UG_PixelAdd(&s, x0 - x, y0 - y);
+      _UG_PixelAdd(&s, x0 + x, y0 + y);
+      _UG_PixelAdd(&s, x0 + x, y0 - y);
+      _UG_PixelAdd(&s, x0 - y, y0 + x);
+      _UG_PixelAdd(&s, x0 - y, y0 - x);
+      _UG_PixelAdd(&s, x0 + y, y0 + x);
+      _UG_PixelAdd(&s, x0 + y, y0 - x);
 
       y++;
       e += yd;
@@ -276,77 +393,84 @@ void UG_DrawCircle( UG_S16 x0, UG_S16 y0, UG_S16 r, UG_COLOR c )
          xd += 2;
       }
    }
+   _UG_PixelFlush(&s);
 }
 
 void UG_FillCircle( UG_S16 x0, UG_S16 y0, UG_S16 r, UG_COLOR c )
 {
-   UG_S16  x,y,xd;
+   UG_S16 x,y,xd,yd,e,px;
+   _UG_SPANS s;
 
-   if ( x0<0 ) return;
-   if ( y0<0 ) return;
    if ( r<=0 ) return;
+   if ( _UG_ClipTest(x0 - r, y0 - r, x0 + r, y0 + r) == _UG_CLIP_OUT ) return;
 
-   xd = 3 - (r << 1);
-   x = 0;
-   y = r;
+   /* Same steps as UG_DrawCircle, one span per row between the outline points */
+   xd = 1 - (r << 1);
+   yd = 0;
+   e = 0;
+   x = r;
+   y = 0;
+   s.count = 0;
 
-   while ( x <= y )
+   while ( x >= y )
    {
-     if( y > 0 )
-     {
-        UG_DrawLine(x0 - x, y0 - y,x0 - x, y0 + y, c);
-        UG_DrawLine(x0 + x, y0 - y,x0 + x, y0 + y, c);
-     }
-     if( x > 0 )
-     {
-        UG_DrawLine(x0 - y, y0 - x,x0 - y, y0 + x, c);
-        UG_DrawLine(x0 + y, y0 - x,x0 + y, y0 + x, c);
-     }
-     if ( xd < 0 )
-     {
-        xd += (x << 2) + 6;
-     }
-     else
-     {
-        xd += ((x - y) << 2) + 10;
-        y--;
-     }
-     x++;
+      _UG_SpanAdd(&s, y0 - y, x0 - x, x0 + x, c);
+      if ( y > 0 ) _UG_SpanAdd(&s, y0 + y, x0 - x, x0 + x, c);
+
+      px = x;
+      y++;
+      e += yd;
+      yd += 2;
+      if ( ((e << 1) + xd) > 0 )
+      {
+         x--;
+         e += xd;
+         xd += 2;
+      }
+      /* Rows px away are at their widest when x changes */
+      if ( (x != px || x < y) && px != y - 1 )
+      {
+         _UG_SpanAdd(&s, y0 - px, x0 - y + 1, x0 + y - 1, c);
+         _UG_SpanAdd(&s, y0 + px, x0 - y + 1, x0 + y - 1, c);
+      }
    }
-   UG_DrawCircle(x0, y0, r,c);
+   _UG_SpanFlush(&s);
 }
 
 void UG_DrawArc( UG_S16 x0, UG_S16 y0, UG_S16 r, UG_U8 s, UG_COLOR c )
 {
    UG_S16 x,y,xd,yd,e;
+   _UG_PIXELS p;
 
-   if ( x0<0 ) return;
-   if ( y0<0 ) return;
    if ( r<=0 ) return;
+   p.clip = _UG_ClipTest(x0 - r, y0 - r, x0 + r, y0 + r);
+   if ( p.clip == _UG_CLIP_OUT ) return;
 
    xd = 1 - (r << 1);
    yd = 0;
    e = 0;
    x = r;
    y = 0;
+   p.count = 0;
+   p.c = c;
 
    while ( x >= y )
    {
       // Q1
-      if ( s & 0x01 ) gui->device->pset(x0 + x, y0 - y, c);
-      if ( s & 0x02 ) gui->device->pset(x0 + y, y0 - x, c);
+      if ( s & 0x01 ) _UG_PixelAdd(&p, x0 + x, y0 - y);
+      if ( s & 0x02 ) _UG_PixelAdd(&p, x0 + y, y0 - x);
 
       // Q2
-      if ( s & 0x04 ) gui->device->pset(x0 - y, y0 - x, c);
-      if ( s & 0x08 ) gui->device->pset(x0 - x, y0 - y, c);
+      if ( s & 0x04 ) _UG_PixelAdd(&p, x0 - y, y0 - x);
+      if ( s & 0x08 ) _UG_PixelAdd(&p, x0 - x, y0 - y);
 
       // Q3
-      if ( s & 0x10 ) gui->device->pset(x0 - x, y0 + y, c);
-      if ( s & 0x20 ) gui->device->pset(x0 - y, y0 + x, c);
+      if ( s & 0x10 ) _UG_PixelAdd(&p, x0 - x, y0 + y);
+      if ( s & 0x20 ) _UG_PixelAdd(&p, x0 - y, y0 + x);
 
       // Q4
-      if ( s & 0x40 ) gui->device->pset(x0 + y, y0 + x, c);
-      if ( s & 0x80 ) gui->device->pset(x0 + x, y0 + y, c);
+      if ( s & 0x40 ) _UG_PixelAdd(&p, x0 + y, y0 + x);
+      if ( s & 0x80 ) _UG_PixelAdd(&p, x0 + x, y0 + y);
 
       y++;
       e += yd;
@@ -358,16 +482,31 @@ void UG_DrawArc( UG_S16 x0, UG_S16 y0, UG_S16 r, UG_U8 s, UG_COLOR c )
          xd += 2;
       }
    }
+   _UG_PixelFlush(&p);
 }
 
 void UG_DrawLine( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
 {
-   UG_S16 n, dx, dy, sgndx, sgndy, dxabs, dyabs, x, y, drawx, drawy;
+   UG_S16 n, dx, dy, sgndx, sgndy, dxabs, dyabs, x, y, drawx, drawy, xs;
+   UG_U8 clip = _UG_ClipTest(x1<x2?x1:x2, y1<y2?y1:y2, x1<x2?x2:x1, y1<y2?y2:y1);
+   _UG_SPANS s;
+
+   if ( clip == _UG_CLIP_OUT ) return;
 
    /* Is hardware acceleration available? */
    if ( gui->driver[DRIVER_DRAW_LINE].state & DRIVER_ENABLED )
    {
-      if( ((UG_RESULT(*)(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c))gui->driver[DRIVER_DRAW_LINE].driver)(x1,y1,x2,y2,c) == UG_RESULT_OK ) return;
+      if ( clip == _UG_CLIP_PART && (x1 == x2 || y1 == y2) )
+      {
+         if ( x2 < x1 ) swap(x1,x2);                          // Straight lines are clipped like a frame
+         if ( y2 < y1 ) swap(y1,y2);
+         _UG_ClipArea(&x1, &y1, &x2, &y2);
+         clip = _UG_CLIP_IN;
+      }
+      if ( clip == _UG_CLIP_IN )
+      {
+         if( ((UG_RESULT(*)(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c))gui->driver[DRIVER_DRAW_LINE].driver)(x1,y1,x2,y2,c) == UG_RESULT_OK ) return;
+      }
    }
 
    dx = x2 - x1;
@@ -380,25 +519,30 @@ void UG_DrawLine( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
    y = dxabs >> 1;
    drawx = x1;
    drawy = y1;
-
-   gui->device->pset(drawx, drawy,c);
+   s.count = 0;
 
    if( dxabs >= dyabs )
    {
+      /* Shallow line, one horizontal run per row */
+      xs = drawx;
       for( n=0; n<dxabs; n++ )
       {
          y += dyabs;
          if( y >= dxabs )
          {
             y -= dxabs;
+            _UG_SpanAdd(&s, drawy, xs, drawx, c);
             drawy += sgndy;
+            xs = drawx + sgndx;
          }
          drawx += sgndx;
-         gui->device->pset(drawx, drawy,c);
       }
+      _UG_SpanAdd(&s, drawy, xs, drawx, c);
    }
    else
    {
+      /* Steep line, one pixel per row. The span driver merges the vertical runs */
+      _UG_SpanAdd(&s, drawy, drawx, drawx, c);
       for( n=0; n<dyabs; n++ )
       {
          x += dxabs;
@@ -408,9 +552,10 @@ void UG_DrawLine( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
             drawx += sgndx;
          }
          drawy += sgndy;
-         gui->device->pset(drawx, drawy,c);
+         _UG_SpanAdd(&s, drawy, drawx, drawx, c);
       }
-   }  
+   }
+   _UG_SpanFlush(&s);
 }
 
 
@@ -425,6 +570,7 @@ void UG_DrawTriangle( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_S16 x3, UG_
 void UG_FillTriangle( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_S16 x3, UG_S16 y3, UG_COLOR c ){
 
   UG_S16 a, b, y, last;
+  _UG_SPANS s;
 
   /* Sort coordinates by Y order (y3 >= y2 >= y1) */
   if (y1 > y2) {
@@ -471,6 +617,7 @@ void UG_FillTriangle( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_S16 x3, UG_
    * in the second loop...which also avoids a /0 error here if y1=y2
    * (flat-topped triangle).
    */
+  s.count = 0;
   if (y2 == y3) {
     last = y2;   /* Include y2 scanline */
   } else {
@@ -489,7 +636,7 @@ void UG_FillTriangle( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_S16 x3, UG_
     if (a > b) {
       swap(a, b);
     }
-    UG_DrawLine(a, y, b + 1, y, c);
+    _UG_SpanAdd(&s, y, a, b + 1, c);
   }
 
   /* For lower part of triangle, find scanline crossings for segments
@@ -509,19 +656,26 @@ void UG_FillTriangle( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_S16 x3, UG_
     if (a > b) {
       swap(a, b);
     }
-    UG_DrawLine(a, y, b + 1, y, c);
+    _UG_SpanAdd(&s, y, a, b + 1, c);
   }
+  _UG_SpanFlush(&s);
 }
 
 void UG_PutString( UG_S16 x, UG_S16 y, char* str )
 {
    UG_S16 xp,yp,cw;
    UG_CHAR chr;
+   UG_U8 line_mode;
+   _UG_LINE line;
 
    xp=x;
    yp=y;
 
    _UG_FontSelect(gui->font);
+   line_mode = _UG_LineMode(gui->char_h_space);
+   line.count = 0;
+   line.fc = gui->fore_color;
+   line.bc = gui->back_color;
    while ( *str != 0 )
    {
       #ifdef UGUI_USE_UTF8
@@ -546,12 +700,17 @@ void UG_PutString( UG_S16 x, UG_S16 y, char* str )
       {
          xp = x;
          yp +=  gui->currentFont.char_height+gui->char_v_space;
+         _UG_LineFlush(&line);
       }
 
-      _UG_PutChar(chr, xp, yp, gui->fore_color, gui->back_color);
+      if ( line_mode )
+         _UG_LineAdd(&line, chr, xp, yp);
+      else
+         _UG_PutChar(chr, xp, yp, gui->fore_color, gui->back_color);
 
       xp += cw + gui->char_h_space;
    }
+   _UG_LineFlush(&line);
    if((gui->driver[DRIVER_FILL_AREA].state & DRIVER_ENABLED))
      ((void*(*)(UG_S16, UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_FILL_AREA].driver)(-1,-1,-1,-1);   // -1 to indicate finish
 }
@@ -565,6 +724,53 @@ void UG_PutChar( UG_CHAR chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc )
 }
 
 #if defined(UGUI_USE_CONSOLE)
+/* Starts scrolling the console by hardware, called once the console area has been cleared */
+static void _UG_ConsoleScrollStart( void )
+{
+   UG_S16 lh = gui->currentFont.char_height+gui->char_v_space;
+   UG_S16 ye = gui->console.y_start + ((gui->console.y_end-gui->console.y_start-gui->currentFont.char_height)/lh+1)*lh - 1;   // Whole lines only, so the rows wrap on a line
+
+   if ( ye > gui->console.y_end ) ye = gui->console.y_end;   // The v_space of the last line may not fit
+   if ( !gui->console.scroll || !(gui->driver[DRIVER_VSCROLL].state & DRIVER_ENABLED) ) return;
+   if ( ye < gui->console.y_start+lh ) return;
+   if ( ((UG_RESULT(*)(UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_VSCROLL].driver)(gui->console.y_start, ye, gui->console.y_start) != UG_RESULT_OK ) return;
+   gui->console.scroll_end = ye;
+   gui->console.scroll_top = -1;
+}
+
+/*
+ * New line while scrolling by hardware. Once the area is full the lines are written over the oldest one,
+ * which is cleared and moved to the bottom by changing the scroll start
+ */
+static void _UG_ConsoleScroll( void )
+{
+   UG_S16 lh = gui->currentFont.char_height+gui->char_v_space;
+   UG_S16 ye;
+
+   if ( gui->console.y_pos+gui->currentFont.char_height > gui->console.y_end )   // Same fit rule as UG_ConsolePutString
+   {
+      gui->console.y_pos = gui->console.y_start;
+      gui->console.scroll_top = gui->console.y_start;
+   }
+   if ( gui->console.scroll_top < 0 ) return;              // Area not full yet
+   ye = gui->console.y_pos+lh-1;
+   if ( ye > gui->console.scroll_end ) ye = gui->console.scroll_end;
+   UG_FillFrame(gui->console.x_start, gui->console.y_pos, gui->console.x_end, ye, gui->console.back_color);
+   gui->console.scroll_top = gui->console.y_pos+lh;
+   if ( gui->console.scroll_top > gui->console.scroll_end ) gui->console.scroll_top = gui->console.y_start;
+   ((UG_RESULT(*)(UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_VSCROLL].driver)(gui->console.y_start, gui->console.scroll_end, gui->console.scroll_top);
+}
+
+/* Stops scrolling by hardware, the console is cleared on the next string */
+static void _UG_ConsoleScrollEnd( void )
+{
+   if ( gui->console.scroll_end < 0 ) return;
+   ((UG_RESULT(*)(UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_VSCROLL].driver)(-1, -1, -1);
+   gui->console.scroll_end = -1;
+   gui->console.x_pos = gui->console.x_end;
+   gui->console.y_pos = gui->console.y_end;
+}
+
 void UG_ConsolePutString( char* str )
 {
    UG_CHAR chr;
@@ -587,7 +793,6 @@ void UG_ConsolePutString( char* str )
       if ( chr == '\n' )
       {
          gui->console.x_pos = gui->device->x_dim;
-         str++;
          continue;
       }
       
@@ -601,12 +806,14 @@ void UG_ConsolePutString( char* str )
       {
          gui->console.x_pos = gui->console.x_start;
          gui->console.y_pos +=  gui->currentFont.char_height+gui->char_v_space;
+         if ( gui->console.scroll_end >= 0 ) _UG_ConsoleScroll();
       }
       if ( gui->console.y_pos+ gui->currentFont.char_height > gui->console.y_end )
       {
          gui->console.x_pos = gui->console.x_start;
          gui->console.y_pos = gui->console.y_start;
          UG_FillFrame(gui->console.x_start,gui->console.y_start,gui->console.x_end,gui->console.y_end,gui->console.back_color);
+         _UG_ConsoleScrollStart();
       }
 
       _UG_PutChar(chr, gui->console.x_pos, gui->console.y_pos, gui->console.fore_color, gui->console.back_color);
@@ -617,6 +824,7 @@ void UG_ConsolePutString( char* str )
 
 void UG_ConsoleSetArea( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye )
 {
+   _UG_ConsoleScrollEnd();
    gui->console.x_start = xs;
    gui->console.y_start = ys;
    gui->console.x_end = xe;
@@ -632,6 +840,18 @@ void UG_ConsoleSetBackcolor( UG_COLOR c )
 {
    gui->console.back_color = c;
 }
+
+/*
+ * Scrolls the console by hardware when it's full, with DRIVER_VSCROLL. Only the new line is drawn instead of clearing the console.
+ * The whole screen width scrolls, so the console should span it. Takes effect on a cleared console, the font must not change while scrolling
+ */
+void UG_ConsoleSetScroll( UG_U8 enable )
+{
+   _UG_ConsoleScrollEnd();
+   gui->console.scroll = enable;
+   gui->console.x_pos = gui->console.x_end;
+   gui->console.y_pos = gui->console.y_end;
+}
 #endif
 
 void UG_SetForecolor( UG_COLOR c )
@@ -746,17 +966,22 @@ UG_CHAR _UG_DecodeUTF8(char **str) {
  *  Load char bitmap address into p, return the font width
  */
 UG_S16 _UG_GetCharData(UG_CHAR encoding,  const UG_U8 **p){
-  static UG_CHAR last_encoding;
-  static UG_S16 last_width;
-  static const UG_U8 * last_p;
-  static UG_FONT * last_font;
+  static struct{
+    UG_FONT * font;
+    UG_CHAR encoding;
+    UG_S16 width;
+    const UG_U8 * p;
+  } cache[UG_GLYPH_CACHE];                                                  // Direct mapped by the low bits of the encoding
   const UG_U8 * offset = gui->currentFont.offsets;
   UG_U16 char_start=0, char_stop=0, skip=0;
+  UG_U8 slot = (UG_U8)encoding & (UG_GLYPH_CACHE-1);
 
-  if( gui->currentFont.font==last_font && encoding==last_encoding){       // If called with the same arguments, return cached data
-    if(p) *p=last_p;                                                      // Load char bitmap address if available. Sometimes called with null p to get only the cached width.
-    return last_width;                                                    // Return width.
+  if( gui->currentFont.font==cache[slot].font && encoding==cache[slot].encoding){   // If called with the same arguments, return cached data
+    if(p) *p=cache[slot].p;                                               // Load char bitmap address if available. Sometimes called with null p to get only the cached width.
+    return cache[slot].width;                                             // Return width.
   }
+  cache[slot].font = NULL;                                                  // Invalid until found
+  cache[slot].encoding = encoding;                                          // Cached by the requested encoding, before the old font remap
   if( gui->currentFont.is_old_font){                                      // Compatibility with old fonts charset
     switch (encoding)
     {
@@ -772,7 +997,23 @@ UG_S16 _UG_GetCharData(UG_CHAR encoding,  const UG_U8 **p){
   }
 
 
-  while(1)                                                                  // Seek through the offsets
+  if( gui->currentFont.range_count){                                        // Binary search the range index
+    UG_U8 lo=0, hi=gui->currentFont.range_count, mid;
+    while(1)
+    {
+      if(lo>=hi)
+        return -1;                                                          // The char is not in the font
+      mid = (lo+hi)>>1;
+      if(encoding < gui->currentFont.ranges[mid].start)
+        hi = mid;
+      else if(encoding > gui->currentFont.ranges[mid].stop)
+        lo = mid+1;
+      else
+        break;
+    }
+    skip = gui->currentFont.ranges[mid].skip + (encoding-gui->currentFont.ranges[mid].start);
+  }
+  else while(1)                                                             // Seek through the offsets
   {
     UG_U8 offset_type = *offset++;                                          // Fist byte indicates offset type: single char, range start, offset end
     if(offset_type == 0xFF)
@@ -800,16 +1041,56 @@ UG_S16 _UG_GetCharData(UG_CHAR encoding,  const UG_U8 **p){
       skip += (char_stop-char_start)+1;                                     // Encoding not found in the current range, increase skip size and clear range flasg
     }
   }
-  last_font =  gui->currentFont.font;                                       // Update cached data
-  last_encoding = encoding;
-  last_p = ( gui->currentFont.data+(skip*gui->currentFont.bytes_per_char));
+  cache[slot].font =  gui->currentFont.font;                                // Update cached data
+  if( gui->currentFont.is_rle)                                              // Variable size glyphs, use the glyph offset table
+    cache[slot].p = gui->currentFont.data + 2*gui->currentFont.number_of_chars + ptr_8to16(gui->currentFont.data+2*skip);
+  else
+    cache[slot].p = ( gui->currentFont.data+(skip*gui->currentFont.bytes_per_char));
   if( gui->currentFont.widths)                                              // If width table available
-    last_width = *( gui->currentFont.widths+skip);                          // Use width from table
+    cache[slot].width = *( gui->currentFont.widths+skip);                   // Use width from table
   else
-    last_width =  gui->currentFont.char_width;                              // Else use width from char width
+    cache[slot].width =  gui->currentFont.char_width;                       // Else use width from char width
   if(p)
-    *p=last_p;                                                              // Load char bitmap address
-  return(last_width);                                                       // Return char width
+    *p=cache[slot].p;                                                       // Load char bitmap address
+  return(cache[slot].width);                                                // Return char width
+}
+
+/*
+ * Builds the range index of the current font offset table. Adjacent entries are merged
+ */
+void _UG_FontIndex( void ){
+  const UG_U8 * offset = gui->currentFont.offsets;
+  UG_FONT_RANGE * r = gui->currentFont.ranges;
+  UG_U16 char_start, char_stop, skip=0;
+  UG_U8 n=0;
+
+  while(1)
+  {
+    UG_U8 offset_type = *offset++;
+    if(offset_type == 0xFF)
+      break;
+    char_start = char_stop = ptr_8to16(offset);
+    offset+=2;
+    if(offset_type==1){
+      char_stop = ptr_8to16(offset);
+      offset+=2;
+    }
+    if(n && char_start==r[n-1].stop+1){                                    // Continues the previous range
+      r[n-1].stop = char_stop;
+    }
+    else if(n==UG_FONT_RANGES){                                             // Too many, use the linear scan
+      n = 0;
+      break;
+    }
+    else{
+      r[n].start = char_start;
+      r[n].stop = char_stop;
+      r[n].skip = skip;
+      n++;
+    }
+    skip += (char_stop-char_start)+1;
+  }
+  gui->currentFont.range_count = n;
 }
 
 /*
@@ -828,7 +1109,8 @@ void _UG_FontSelect( UG_FONT *font){
   font+=2;
   gui->currentFont.bytes_per_char = ptr_8to16(font);      // Bytes 6+7: Bytes per char
   font+=2;                                                // Byte 8: Flags
-  gui->currentFont.font_type = *font & 0x3F;              // Bits 5-0: Font BPP
+  gui->currentFont.font_type = *font & 0x1F;              // Bits 4-0: Font BPP
+  gui->currentFont.is_rle = (*font & 0x20)&&1;            // Bit 5:  1=Run length encoded glyphs
   gui->currentFont.is_old_font = (*font & 0x80)&&1;       // Bit 7:  1=old font, 0=new font
   if(*font++ & 0x40){                                     // Bit 6: 1=Width table present, 0=not present
     gui->currentFont.widths = font;                       // Save pointer to width table
@@ -840,8 +1122,115 @@ void _UG_FontSelect( UG_FONT *font){
   gui->currentFont.offsets = font;                        // Save pointer to offset table
   font += gui->currentFont.offset_size;                   // Skip offset table
   gui->currentFont.data = font;                           // Save pointer to bitmap data
+  _UG_FontIndex();                                        // Index the offset table for the lookups
+}
+
+#if defined(UGUI_USE_COLOR_RGB888)
+static UG_COLOR _UG_BlendColor( UG_COLOR fc, UG_COLOR bc, UG_U8 b )
+{
+   return ((((fc & 0xFF) * b + (bc & 0xFF) * (256 - b)) >> 8) & 0xFF) |            //Blue component
+          ((((fc & 0xFF00) * b + (bc & 0xFF00) * (256 - b)) >> 8)  & 0xFF00) |     //Green component
+          ((((fc & 0xFF0000) * b + (bc & 0xFF0000) * (256 - b)) >> 8) & 0xFF0000); //Red component
+}
+#elif defined(UGUI_USE_COLOR_RGB565)
+#define _UG_BlendColor UG_KernelBlendPixel565
+#endif
+
+#if defined(UGUI_USE_COLOR_RGB888) || defined(UGUI_USE_COLOR_RGB565)
+/* Blends a row of 8BPP coverage */
+static void _UG_BlendRow( UG_COLOR* dst, const UG_U8* a, UG_U16 n, UG_COLOR fc, UG_COLOR bc )
+{
+   #if defined(UGUI_USE_COLOR_RGB565)
+   UG_KernelBlend565(dst, a, n, fc, bc);
+   #else
+   while ( n-- ) *dst++ = _UG_BlendColor(fc, bc, *a++);
+   #endif
+}
+#endif
+
+#if defined(UGUI_GLYPH_BLEND_CACHE) && defined(UGUI_USE_COLOR_RGB565)
+/*
+ * Pre-blended 8BPP glyphs, least recently used slot is replaced.
+ * The buffer is split in slots of the current font char size, changing the size clears the cache
+ */
+static struct
+{
+   UG_COLOR buf[UGUI_GLYPH_BLEND_CACHE / sizeof(UG_COLOR)];
+   struct
+   {
+      const UG_U8* glyph;                          // Glyph data in the font, NULL if free
+      UG_COLOR fc;
+      UG_COLOR bc;
+      UG_U32 used;                                 // Last use, 0 if free
+   } slot[UG_GLYPH_BLEND_SLOTS];
+   UG_U16 size;                                    // Pixels per slot
+   UG_U8 slots;
+   UG_U32 clock;
+   UG_U32 hits;
+   UG_U32 misses;
+} _UG_BLEND;
+
+void UG_GlyphCacheStats( UG_U32* hits, UG_U32* misses )
+{
+   if ( hits ) *hits = _UG_BLEND.hits;
+   if ( misses ) *misses = _UG_BLEND.misses;
+}
+
+void UG_GlyphCacheClear( void )
+{
+   UG_U8 i;
+
+   for( i=0; i<UG_GLYPH_BLEND_SLOTS; i++ )
+   {
+      _UG_BLEND.slot[i].glyph = NULL;
+      _UG_BLEND.slot[i].used = 0;
+   }
+   _UG_BLEND.clock = 0;
 }
 
+/* Returns the glyph blended with fc and bc, NULL if the chars don't fit in the cache */
+static const UG_COLOR* _UG_BlendCacheGet( const UG_U8* glyph, UG_S16 w, UG_COLOR fc, UG_COLOR bc )
+{
+   UG_U16 size = gui->currentFont.char_width * gui->currentFont.char_height;
+   UG_U16 i, j;
+   UG_U8 n, lru = 0;
+   UG_COLOR* dst;
+
+   if ( size != _UG_BLEND.size )
+   {
+      UG_GlyphCacheClear();
+      _UG_BLEND.size = size;
+      i = size ? sizeof(_UG_BLEND.buf) / sizeof(UG_COLOR) / size : 0;
+      _UG_BLEND.slots = i > UG_GLYPH_BLEND_SLOTS ? UG_GLYPH_BLEND_SLOTS : i;
+   }
+   if ( !_UG_BLEND.slots ) return NULL;
+   _UG_BLEND.clock++;
+   for( n=0; n<_UG_BLEND.slots; n++ )
+   {
+      if ( _UG_BLEND.slot[n].glyph == glyph && _UG_BLEND.slot[n].fc == fc && _UG_BLEND.slot[n].bc == bc )
+      {
+         _UG_BLEND.slot[n].used = _UG_BLEND.clock;
+         _UG_BLEND.hits++;
+         return &_UG_BLEND.buf[n * size];
+      }
+      if ( _UG_BLEND.slot[n].used < _UG_BLEND.slot[lru].used ) lru = n;
+   }
+   _UG_BLEND.misses++;
+   _UG_BLEND.slot[lru].glyph = glyph;
+   _UG_BLEND.slot[lru].fc = fc;
+   _UG_BLEND.slot[lru].bc = bc;
+   _UG_BLEND.slot[lru].used = _UG_BLEND.clock;
+   dst = &_UG_BLEND.buf[lru * size];
+   for( j=0; j<gui->currentFont.char_height; j++ )
+   {
+      UG_KernelBlend565(dst, glyph, w, fc, bc);       // Stored with the actual char width as stride
+      dst += w;
+      glyph += gui->currentFont.char_width;
+   }
+   return &_UG_BLEND.buf[lru * size];
+}
+#endif
+
 UG_S16 _UG_PutChar( UG_CHAR chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc)
 {
    UG_U16 x0=0,y0=0,i,j,k,bn,fpixels=0,bpixels=0;
@@ -850,6 +1239,8 @@ UG_S16 _UG_PutChar( UG_CHAR chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc)
    const UG_U8 * data;                              // Pointer to current char bitmap
    UG_COLOR color;
    void(*push_pixels)(UG_SIZE, UG_COLOR) = NULL;
+   void(*pset)(UG_S16, UG_S16, UG_COLOR);
+   UG_U8 clip;
 
    UG_S16 actual_char_width = _UG_GetCharData(chr, &data);
    if(actual_char_width==-1)
@@ -862,13 +1253,68 @@ UG_S16 _UG_PutChar( UG_CHAR chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc)
    bn >>= 3;
    if (  gui->currentFont.char_width % 8 ) bn++;
 
+   clip = _UG_ClipTest(x, y, x+actual_char_width-1, y+gui->currentFont.char_height-1);
+   if ( clip == _UG_CLIP_OUT ) return (actual_char_width);
+   pset = (clip == _UG_CLIP_IN) ? gui->device->pset : _UG_PSetClip;   // Driver windows are clipped by _UG_FillArea
+
+   #if defined(UGUI_GLYPH_BLEND_CACHE) && defined(UGUI_USE_COLOR_RGB565)
+   if ( gui->currentFont.font_type == FONT_TYPE_8BPP && (gui->driver[DRIVER_DRAW_BMP].state & DRIVER_ENABLED) && clip == _UG_CLIP_IN )
+   {
+      const UG_COLOR* blended = _UG_BlendCacheGet(data, actual_char_width, fc, bc);
+      if ( blended )
+      {
+         UG_BMP bmp = { blended, actual_char_width, gui->currentFont.char_height, BMP_BPP_16, BMP_RGB565 | BMP_RAM };
+         ((void(*)(UG_S16, UG_S16, UG_BMP*))gui->driver[DRIVER_DRAW_BMP].driver)(x, y, &bmp);
+         return (actual_char_width);
+      }
+   }
+   #endif
+
    /* Is hardware acceleration available? */
    if (driver)
    {
-     push_pixels = ((void*(*)(UG_S16, UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_FILL_AREA].driver)(x,y,x+actual_char_width-1,y+ gui->currentFont.char_height-1);
+     push_pixels = _UG_FillArea(x,y,x+actual_char_width-1,y+ gui->currentFont.char_height-1);
    }
 
-   if ( gui->currentFont.font_type == FONT_TYPE_1BPP)
+   if ( gui->currentFont.is_rle )
+   {
+     UG_U16 n, run=0, pos=0, total=actual_char_width*gui->currentFont.char_height;
+     UG_U8 fg=0;
+
+     if(trans && driver)
+       push_pixels = NULL;                          // Transparent runs set their own window
+     while( pos+run < total )
+     {
+       b = *data++;
+       n = b >> 4;                                  // Background run
+       if(n)
+       {
+         if(fg && run)
+         {
+           _UG_PutRun(x, y, actual_char_width, pos, run, fc, 1, push_pixels);
+           pos += run;
+           run = 0;
+         }
+         fg = 0;
+         run += n;
+       }
+       n = b & 0x0F;                                // Foreground run
+       if(n)
+       {
+         if(!fg && run)
+         {
+           _UG_PutRun(x, y, actual_char_width, pos, run, bc, 0, push_pixels);
+           pos += run;
+           run = 0;
+         }
+         fg = 1;
+         run += n;
+       }
+     }
+     if(run)
+       _UG_PutRun(x, y, actual_char_width, pos, run, fg ? fc : bc, fg, push_pixels);
+   }
+   else if ( gui->currentFont.font_type == FONT_TYPE_1BPP)
    {
      for( j=0;j< gui->currentFont.char_height;j++ )
      {
@@ -896,7 +1342,7 @@ UG_S16 _UG_PutChar( UG_CHAR chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc)
              }
              else
              {                              // Not accelerated output
-               gui->device->pset(x+c,y+j,fc);
+               pset(x+c,y+j,fc);
              }
            }
            else                             // Background pixel detected
@@ -916,13 +1362,13 @@ UG_S16 _UG_PutChar( UG_CHAR chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc)
                      UG_U16 width = (x+actual_char_width)-x0;         // Detect available pixels in the current row from current x position
                      if(x0==x || fpixels<width)                       // If pixel draw count is lower than available pixels, or drawing at start of the row, drawn as-is
                      {
-                       push_pixels = ((void*(*)(UG_S16, UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_FILL_AREA].driver)(x0,y0,x0+width-1,y0+(fpixels/actual_char_width));
+                       push_pixels = _UG_FillArea(x0,y0,x0+width-1,y0+(fpixels/actual_char_width));
                        push_pixels(fpixels,fc);
                        fpixels=0;
                      }
                      else                                             // If  pixel draw count is higher than available pixels, there's at least second line, drawn this row first
                      {
-                       push_pixels = ((void*(*)(UG_S16, UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_FILL_AREA].driver)(x0,y0,x0+width-1,y0);
+                       push_pixels = _UG_FillArea(x0,y0,x0+width-1,y0);
                        push_pixels(fpixels,fc);
                        fpixels -= width;
                        x0=x;
@@ -935,7 +1381,7 @@ UG_S16 _UG_PutChar( UG_CHAR chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc)
              }
              else if(!trans)                           // Not accelerated output
              {
-               gui->device->pset(x+c,y+j,bc);
+               pset(x+c,y+j,bc);
              }
            }
            b >>= 1;
@@ -961,13 +1407,13 @@ UG_S16 _UG_PutChar( UG_CHAR chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc)
              UG_U16 width = (x+actual_char_width)-x0;
              if(x0==x || fpixels<width)
              {
-               push_pixels = ((void*(*)(UG_S16, UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_FILL_AREA].driver)(x0,y0,x0+width-1,y0+(fpixels/actual_char_width));
+               push_pixels = _UG_FillArea(x0,y0,x0+width-1,y0+(fpixels/actual_char_width));
                push_pixels(fpixels,fc);
                fpixels=0;
              }
              else
              {
-               push_pixels = ((void*(*)(UG_S16, UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_FILL_AREA].driver)(x0,y0,x0+width-1,y0);
+               push_pixels = _UG_FillArea(x0,y0,x0+width-1,y0);
                push_pixels(fpixels,fc);
                fpixels -= width;
                x0=x;
@@ -981,30 +1427,186 @@ UG_S16 _UG_PutChar( UG_CHAR chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc)
    #if defined(UGUI_USE_COLOR_RGB888) || defined(UGUI_USE_COLOR_RGB565)
    else if ( gui->currentFont.font_type == FONT_TYPE_8BPP)
    {
+     UG_COLOR row[UG_PIXEL_BATCH];
+
      for( j=0;j< gui->currentFont.char_height;j++ )
      {
-       for( i=0;i<actual_char_width;i++ )
+       for( i=0;i<actual_char_width;i+=k )
        {
-         b = *data++;
-         color = ((((fc & 0xFF) * b + (bc & 0xFF) * (256 - b)) >> 8) & 0xFF) |            //Blue component
-                 ((((fc & 0xFF00) * b + (bc & 0xFF00) * (256 - b)) >> 8)  & 0xFF00) |     //Green component
-                 ((((fc & 0xFF0000) * b + (bc & 0xFF0000) * (256 - b)) >> 8) & 0xFF0000); //Red component
-         if(driver)
+         k = actual_char_width-i < UG_PIXEL_BATCH ? actual_char_width-i : UG_PIXEL_BATCH;
+         _UG_BlendRow(row, data+i, k, fc, bc);                                            // Blend a piece of the row at once
+         for( c=0;c<k;c+=fpixels )
          {
-           push_pixels(1,color);                                                          // Accelerated output
-         }
-         else
-         {
-           gui->device->pset(x+i,y+j,color);                                                // Not accelerated output
+           color = row[c];
+           if(driver)
+           {
+             for( fpixels=1;c+fpixels<k && row[c+fpixels]==color;fpixels++ );
+             push_pixels(fpixels,color);                                                  // Accelerated output, equal pixels in one push
+           }
+           else
+           {
+             fpixels=1;
+             pset(x+i+c,y+j,color);                                          // Not accelerated output
+           }
          }
        }
-       data +=  gui->currentFont.char_width - actual_char_width;
+       data +=  gui->currentFont.char_width;
      }
    }
    #endif
    return (actual_char_width);
 }
 
+/*
+ * Draws a run of n glyph pixels, starting at pixel pos of a char w pixels wide.
+ * push_pixels is the FILL_AREA output for the whole char, or NULL to address every row
+ */
+void _UG_PutRun( UG_S16 x, UG_S16 y, UG_S16 w, UG_U16 pos, UG_U16 n, UG_COLOR c, UG_U8 fg, void(*push_pixels)(UG_SIZE, UG_COLOR) )
+{
+   UG_U16 col, row, len, i;
+   UG_U8 driver=(gui->driver[DRIVER_FILL_AREA].state & DRIVER_ENABLED);
+
+   if ( !fg && gui->transparent_font ) return;                // Transparent background
+   if ( push_pixels )
+   {
+      push_pixels(n, c);                                       // Window set for the whole char, runs wrap through the rows
+      return;
+   }
+   while ( n )
+   {
+      col = pos % w;
+      row = pos / w;
+      len = w - col;
+      if ( col==0 && n>=w ) len = n - (n % w);                 // Whole rows fit in a single window
+      else if ( len > n ) len = n;
+      if ( driver )
+      {
+         push_pixels = _UG_FillArea(x+col, y+row, x+col+(len<w?len:w)-1, y+row+(len-1)/w);
+         push_pixels(len, c);
+      }
+      else
+      {
+         for( i=0; i<len; i++ )
+         {
+            _UG_PSetClip(x+(col+i)%w, y+row+(col+i)/w, c);
+         }
+      }
+      pos += len;
+      n -= len;
+   }
+}
+
+/*
+ * Text lines are drawn in a single FILL_AREA window, streaming one pixel row of every char at a time.
+ * Needs the driver, opaque text and no space between chars, as every pixel of the window is written
+ */
+UG_U8 _UG_LineMode( UG_S16 h_space )
+{
+   #if defined(UGUI_GLYPH_BLEND_CACHE) && defined(UGUI_USE_COLOR_RGB565)
+   if ( gui->currentFont.font_type == FONT_TYPE_8BPP && (gui->driver[DRIVER_DRAW_BMP].state & DRIVER_ENABLED) )
+      return 0;                                                // Each char is a blit from the blend cache
+   #endif
+   return (gui->driver[DRIVER_FILL_AREA].state & DRIVER_ENABLED) && !gui->transparent_font && !h_space;
+}
+
+/* Adds a char of the current font, chars must be consecutive */
+void _UG_LineAdd( _UG_LINE* l, UG_CHAR chr, UG_S16 x, UG_S16 y )
+{
+   const UG_U8* p;
+   UG_S16 w = _UG_GetCharData(chr, &p);
+
+   if ( w <= 0 ) return;
+   if ( l->count == UG_TEXT_LINE_CHARS ) _UG_LineFlush(l);
+   if ( !l->count )
+   {
+      l->x = x;
+      l->y = y;
+      l->w = 0;
+   }
+   l->glyph[l->count].p = p;
+   l->glyph[l->count].w = w;
+   l->glyph[l->count].bg = 0;
+   l->glyph[l->count].fg = 0;
+   l->w += w;
+   l->count++;
+}
+
+static void _UG_LinePush( _UG_LINE* l, UG_COLOR c, UG_SIZE n )
+{
+   if ( l->pixels && l->color != c )
+   {
+      l->push_pixels(l->pixels, l->color);
+      l->pixels = 0;
+   }
+   l->color = c;
+   l->pixels += n;
+}
+
+void _UG_LineFlush( _UG_LINE* l )
+{
+   UG_U16 i, j, k, n, bn;
+   UG_U8 b;
+
+   if ( !l->count ) return;
+   l->push_pixels = _UG_FillArea(l->x, l->y, l->x + l->w - 1, l->y + gui->currentFont.char_height - 1);
+   l->pixels = 0;
+   bn = (gui->currentFont.char_width + 7) >> 3;
+   for( j=0; j<gui->currentFont.char_height; j++ )
+   {
+      for( i=0; i<l->count; i++ )
+      {
+         if ( gui->currentFont.is_rle )
+         {
+            for( n=l->glyph[i].w; n; n-=k )
+            {
+               if ( !l->glyph[i].bg && !l->glyph[i].fg )
+               {
+                  b = *l->glyph[i].p++;
+                  l->glyph[i].bg = b >> 4;
+                  l->glyph[i].fg = b & 0x0F;
+               }
+               if ( l->glyph[i].bg )
+               {
+                  k = l->glyph[i].bg < n ? l->glyph[i].bg : n;
+                  l->glyph[i].bg -= k;
+                  _UG_LinePush(l, l->bc, k);
+               }
+               else
+               {
+                  k = l->glyph[i].fg < n ? l->glyph[i].fg : n;
+                  l->glyph[i].fg -= k;
+                  _UG_LinePush(l, l->fc, k);
+               }
+            }
+         }
+         else if ( gui->currentFont.font_type == FONT_TYPE_1BPP )
+         {
+            const UG_U8* row = l->glyph[i].p + j*bn;
+            for( k=0; k<l->glyph[i].w; k++ )
+            {
+               _UG_LinePush(l, (row[k>>3] >> (k&7)) & 0x01 ? l->fc : l->bc, 1);
+            }
+         }
+         #if defined(UGUI_USE_COLOR_RGB888) || defined(UGUI_USE_COLOR_RGB565)
+         else if ( gui->currentFont.font_type == FONT_TYPE_8BPP )
+         {
+            const UG_U8* row = l->glyph[i].p + j*gui->currentFont.char_width;
+            UG_COLOR blended[UG_PIXEL_BATCH];
+            UG_U16 len, m;
+            for( k=0; k<l->glyph[i].w; k+=len )
+            {
+               len = l->glyph[i].w-k < UG_PIXEL_BATCH ? l->glyph[i].w-k : UG_PIXEL_BATCH;
+               _UG_BlendRow(blended, row+k, len, l->fc, l->bc);
+               for( m=0; m<len; m++ ) _UG_LinePush(l, blended[m], 1);
+            }
+         }
+         #endif
+      }
+   }
+   if ( l->pixels ) l->push_pixels(l->pixels, l->color);
+   l->count = 0;
+}
+
 #ifdef UGUI_USE_TOUCH
 static void _UG_ProcessTouchData( UG_WINDOW* wnd )
 {
@@ -1154,6 +1756,102 @@ static void _UG_HandleEvents( UG_WINDOW* wnd )
 /* -- INTERNAL API FUNCTIONS                                                         -- */
 /* -------------------------------------------------------------------------------- */
 
+/*
+ * Returns the next char of a string and advances the pointer
+ */
+UG_CHAR _UG_NextChar( char** str )
+{
+   #ifdef UGUI_USE_UTF8
+   if(! gui->currentFont.is_old_font){                // Old font charset compatibility
+     return _UG_DecodeUTF8(str);
+   }
+   #endif
+   return *(*str)++;
+}
+
+/*
+ * Splits the text in lines that fit the area width, breaking at spaces when possible.
+ * The result is cached by string, content, font and area, so redrawing an unchanged text skips it
+ */
+_UG_LAYOUT* _UG_TextLayout( UG_TEXT* txt )
+{
+   static _UG_LAYOUT cache[UG_TEXT_LAYOUT_CACHE];
+   static UG_U8 next;
+   _UG_LAYOUT* l;
+   UG_S16 max_w = txt->a.xe - txt->a.xs + 1;
+   UG_S16 w, wl, ws;
+   UG_U16 sum = 0, n;
+   UG_CHAR chr;
+   char *c, *start, *space;
+
+   for( c=txt->str; *c; c++ )                       // Catches texts edited in place
+   {
+      sum = ((sum << 1) | (sum >> 15)) ^ (UG_U8)*c;
+   }
+   for( n=0; n<UG_TEXT_LAYOUT_CACHE; n++ )
+   {
+      l = &cache[n];
+      if ( l->str==txt->str && l->sum==sum && l->font==txt->font && l->h_space==txt->h_space &&
+           l->a.xs==txt->a.xs && l->a.xe==txt->a.xe && l->a.ys==txt->a.ys && l->a.ye==txt->a.ye )
+         return l;
+   }
+
+   l = &cache[next];
+   next = (next + 1) % UG_TEXT_LAYOUT_CACHE;
+   l->str = txt->str;
+   l->sum = sum;
+   l->font = txt->font;
+   l->h_space = txt->h_space;
+   l->a = txt->a;
+   l->lines = 0;
+
+   c = start = txt->str;
+   space = NULL;
+   wl = ws = 0;
+   n = 0;
+   while ( l->lines < UG_TEXT_LAYOUT_LINES )
+   {
+      char* p = c;
+      chr = _UG_NextChar(&c);
+      if ( chr != 0 && chr != '\n' )
+      {
+         w = _UG_GetCharData(chr, NULL);
+         if ( w == -1 ) continue;
+         if ( !n || wl + txt->h_space + w <= max_w )
+         {
+            if ( chr == ' ' )
+            {
+               space = p;                           // Last place to wrap
+               ws = wl;
+            }
+            wl += (n ? txt->h_space : 0) + w;
+            n++;
+            continue;
+         }
+         if ( space )                               // Word wrap
+         {
+            p = space;
+            c = space + 1;
+            wl = ws;
+         }
+         else
+         {
+            c = p;                                  // No space in the line, break the word
+         }
+      }
+      l->line[l->lines].start = start - txt->str;
+      l->line[l->lines].end = p - txt->str;
+      l->line[l->lines].width = wl;
+      l->lines++;
+      if ( chr == 0 ) break;
+      start = c;
+      space = NULL;
+      wl = ws = 0;
+      n = 0;
+   }
+   return l;
+}
+
 void _UG_PutText(UG_TEXT* txt)
 {
    if(!txt->font || !txt->str){
@@ -1163,114 +1861,64 @@ void _UG_PutText(UG_TEXT* txt)
    UG_S16 ye=txt->a.ye;
    UG_S16 ys=txt->a.ys;
    UG_S16 char_height=UG_GetFontHeight(txt->font);
-
-   if ( (ye - ys) < char_height ){
-     return;
-   }
-
-   UG_U16 sl,rc,wl;
-   UG_S16 xp,yp;
+   UG_S16 xp,yp,w;
    UG_S16 xs=txt->a.xs;
    UG_S16 xe=txt->a.xe;
    UG_U8  align=txt->align;
    UG_S16 char_h_space=txt->h_space;
    UG_S16 char_v_space=txt->v_space;
-   UG_S16 w;
    UG_CHAR chr;
-   char* str = txt->str;
-   char* c = str;
-
-   _UG_FontSelect(txt->font);
-
-   rc=1;
-   c=str;
+   UG_U8 line_mode, i;
+   _UG_LINE line;
+   _UG_LAYOUT* l;
+   char *c, *end;
 
-   while (1)
-   {
-     #ifdef UGUI_USE_UTF8
-     if(! gui->currentFont.is_old_font){                // Old font charset compatibility
-       chr = _UG_DecodeUTF8(&c);
-     }
-     else{
-       chr = *c++;
-     }
-     #else
-     chr = *c++;
-     #endif
-     if(!chr) break;
-     if ( chr == '\n' ) rc++;
+   if ( (ye - ys + 1) < char_height ){
+     return;
    }
+   _UG_FontSelect(txt->font);
+   l = _UG_TextLayout(txt);
+   line_mode = _UG_LineMode(char_h_space);
+   line.count = 0;
+   line.fc = txt->fc;
+   line.bc = txt->bc;
 
    yp = 0;
    if ( align & (ALIGN_V_CENTER | ALIGN_V_BOTTOM) )
    {
       yp = ye - ys + 1;
-      yp -= char_height*rc;
-      yp -= char_v_space*(rc-1);
-      if ( yp < 0 ){
-        return;
-      }
+      yp -= char_height*l->lines;
+      yp -= char_v_space*(l->lines-1);
+      if ( yp < 0 ) yp = 0;                        // Too many lines, show from the top
    }
    if ( align & ALIGN_V_CENTER ) yp >>= 1;
    yp += ys;
 
-   while( 1 )
+   for( i=0; i<l->lines && yp+char_height-1<=ye; i++ )   // Lines below the area are clipped
    {
-      sl=0;
-      c=str;
-      wl = 0;
-      while(1)
-      {
-        #ifdef UGUI_USE_UTF8
-        if(! gui->currentFont.is_old_font){                // Old font charset compatibility
-          chr = _UG_DecodeUTF8(&c);
-        }
-        else{
-          chr = *c++;
-        }
-        #else
-        chr = *c++;
-        #endif
-        if( chr == 0 || chr == '\n'){
-          break;
-        }
-         w = _UG_GetCharData(chr, NULL);
-         if (w == -1){continue;}
-         sl++;
-         wl += w + char_h_space;
-      }
-      wl -= char_h_space;
-
+      if ( l->line[i].width > xe - xs + 1 ) continue;    // Single char wider than the area
       xp = xe - xs + 1;
-      xp -= wl;
-      if ( xp < 0 ) break;
-
+      xp -= l->line[i].width;
       if ( align & ALIGN_H_LEFT ) xp = 0;
       else if ( align & ALIGN_H_CENTER ) xp >>= 1;
       xp += xs;
 
-
-      while(1){
-         #ifdef UGUI_USE_UTF8
-         if(! gui->currentFont.is_old_font){                // Old font charset compatibility
-           chr = _UG_DecodeUTF8(&str);
-         }
-         else{
-           chr = *str++;
-         }
-         #else
-         chr = *str++;
-         #endif
-         if ( chr == 0 ){
-           return;
-         }
-         else if(chr=='\n'){
-           break;
+      c = txt->str + l->line[i].start;
+      end = txt->str + l->line[i].end;
+      while ( c < end )
+      {
+         chr = _UG_NextChar(&c);
+         if(line_mode){
+           w = _UG_GetCharData(chr, NULL);
+           if(w!=-1)
+             _UG_LineAdd(&line, chr, xp, yp);
          }
-         w = _UG_PutChar(chr,xp,yp,txt->fc,txt->bc);
+         else
+           w = _UG_PutChar(chr,xp,yp,txt->fc,txt->bc);
          if(w!=-1)
            xp += w + char_h_space;
       }
+      _UG_LineFlush(&line);
       yp += char_height + char_v_space;
    }
 }
@@ -1386,23 +2034,172 @@ void _UG_SendObjectPostrenderEvent( UG_WINDOW *wnd, UG_OBJECT *obj )
 
 UG_U32 _UG_ConvertRGB565ToRGB888(UG_U16 c)
 {
-   UG_U32 r,g,b;
+   return UG_KernelPixelRGB565To888(c);
+}
 
-   r = (c&0xF800)<<8;
-   r += (r+7)>>5;
+/* -------------------------------------------------------------------------------- */
+/* -- DRIVER FUNCTIONS                                                           -- */
+/* -------------------------------------------------------------------------------- */
+/* Tests an area against the clip rectangle */
+static UG_U8 _UG_ClipTest( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye )
+{
+   UG_AREA* c = &gui->clip;
 
-   g = (c&0x7E0)<<5;
-   g += (g+3)>>6;
+   if ( xe < c->xs || xs > c->xe || ye < c->ys || ys > c->ye ) return _UG_CLIP_OUT;
+   if ( xs >= c->xs && xe <= c->xe && ys >= c->ys && ye <= c->ye ) return _UG_CLIP_IN;
+   return _UG_CLIP_PART;
+}
 
-   b = (c&0x1F)<<3;
-   b += (b+7)>>5;
+/* Clips an area in place, returns 0 if nothing is left */
+static UG_U8 _UG_ClipArea( UG_S16* xs, UG_S16* ys, UG_S16* xe, UG_S16* ye )
+{
+   UG_AREA* c = &gui->clip;
 
-   return (r | g | b);
+   if ( *xs < c->xs ) *xs = c->xs;
+   if ( *ys < c->ys ) *ys = c->ys;
+   if ( *xe > c->xe ) *xe = c->xe;
+   if ( *ye > c->ye ) *ye = c->ye;
+   return ( *xs <= *xe && *ys <= *ye );
+}
+
+/* pset for primitives partly outside the clip rectangle */
+static void _UG_PSetClip( UG_S16 x, UG_S16 y, UG_COLOR c )
+{
+   if ( x < gui->clip.xs || x > gui->clip.xe || y < gui->clip.ys || y > gui->clip.ye ) return;
+   gui->device->pset(x, y, c);
+}
+
+/* Window opened by _UG_FillArea when only part of it is visible */
+static struct
+{
+   UG_S16 x, y;                                 // Next pixel in the requested window
+   UG_S16 xs, xe;
+   UG_AREA v;                                   // Visible part, the driver window
+   void(*push_pixels)(UG_SIZE, UG_COLOR);
+} _UG_ClipWin;
+
+static void _UG_ClipDiscard( UG_SIZE n, UG_COLOR c )
+{
+   (void)n;
+   (void)c;
+}
+
+/* Walks the requested window row by row and pushes only the visible pixels */
+static void _UG_ClipPush( UG_SIZE n, UG_COLOR c )
+{
+   UG_S16 run, a, b;
+
+   while ( n && _UG_ClipWin.y <= _UG_ClipWin.v.ye )
+   {
+      run = _UG_ClipWin.xe - _UG_ClipWin.x + 1;
+      if ( (UG_SIZE)run > n ) run = n;
+      if ( _UG_ClipWin.y >= _UG_ClipWin.v.ys )
+      {
+         a = _UG_ClipWin.x < _UG_ClipWin.v.xs ? _UG_ClipWin.v.xs : _UG_ClipWin.x;
+         b = _UG_ClipWin.x + run - 1;
+         if ( b > _UG_ClipWin.v.xe ) b = _UG_ClipWin.v.xe;
+         if ( a <= b ) _UG_ClipWin.push_pixels(b - a + 1, c);
+      }
+      n -= run;
+      _UG_ClipWin.x += run;
+      if ( _UG_ClipWin.x > _UG_ClipWin.xe )
+      {
+         _UG_ClipWin.x = _UG_ClipWin.xs;
+         _UG_ClipWin.y++;
+      }
+   }
+}
+
+/* Opens a DRIVER_FILL_AREA window, the driver only gets the part inside the clip rectangle */
+static void(*_UG_FillArea( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye ))(UG_SIZE, UG_COLOR)
+{
+   UG_AREA* v = &_UG_ClipWin.v;
+
+   switch ( _UG_ClipTest(xs, ys, xe, ye) )
+   {
+      case _UG_CLIP_IN:
+         return ((void*(*)(UG_S16, UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_FILL_AREA].driver)(xs,ys,xe,ye);
+      case _UG_CLIP_OUT:
+         return _UG_ClipDiscard;
+   }
+   _UG_ClipWin.x = _UG_ClipWin.xs = xs;
+   _UG_ClipWin.y = ys;
+   _UG_ClipWin.xe = xe;
+   v->xs = xs;
+   v->ys = ys;
+   v->xe = xe;
+   v->ye = ye;
+   _UG_ClipArea(&v->xs, &v->ys, &v->xe, &v->ye);
+   _UG_ClipWin.push_pixels = ((void*(*)(UG_S16, UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_FILL_AREA].driver)(v->xs,v->ys,v->xe,v->ye);
+   return _UG_ClipPush;
+}
+
+/* Sends the collected spans to DRIVER_FILL_SPANS, or draws them as frames */
+static void _UG_SpanFlush( _UG_SPANS* s )
+{
+   UG_U8 i;
+
+   if ( !s->count ) return;
+   if ( gui->driver[DRIVER_FILL_SPANS].state & DRIVER_ENABLED )
+   {
+      if( ((UG_RESULT(*)(const UG_SPAN* spans, UG_U16 count))gui->driver[DRIVER_FILL_SPANS].driver)(s->span, s->count) == UG_RESULT_OK )
+      {
+         s->count = 0;
+         return;
+      }
+   }
+   for( i=0; i<s->count; i++ )
+   {
+      UG_FillFrame(s->span[i].xs, s->span[i].y, s->span[i].xe, s->span[i].y, s->span[i].c);
+   }
+   s->count = 0;
+}
+
+static void _UG_SpanAdd( _UG_SPANS* s, UG_S16 y, UG_S16 xs, UG_S16 xe, UG_COLOR c )
+{
+   UG_SPAN* p = &s->span[s->count];
+
+   if ( xe < xs ) swap(xs,xe);
+   if ( y < gui->clip.ys || y > gui->clip.ye ) return;
+   if ( xs < gui->clip.xs ) xs = gui->clip.xs;
+   if ( xe > gui->clip.xe ) xe = gui->clip.xe;
+   if ( xe < xs ) return;
+   p->y = y;
+   p->xs = xs;
+   p->xe = xe;
+   p->c = c;
+   if ( ++s->count == UG_SPAN_BATCH ) _UG_SpanFlush(s);
+}
+
+/* Sends the collected pixels to DRIVER_DRAW_PIXELS, or draws them one by one */
+static void _UG_PixelFlush( _UG_PIXELS* s )
+{
+   UG_U8 i;
+
+   if ( !s->count ) return;
+   if ( gui->driver[DRIVER_DRAW_PIXELS].state & DRIVER_ENABLED )
+   {
+      if( ((UG_RESULT(*)(UG_POINT* p, UG_U16 count, UG_COLOR c))gui->driver[DRIVER_DRAW_PIXELS].driver)(s->p, s->count, s->c) == UG_RESULT_OK )
+      {
+         s->count = 0;
+         return;
+      }
+   }
+   for( i=0; i<s->count; i++ )
+   {
+      gui->device->pset(s->p[i].x, s->p[i].y, s->c);
+   }
+   s->count = 0;
+}
+
+static void _UG_PixelAdd( _UG_PIXELS* s, UG_S16 x, UG_S16 y )
+{
+   if ( s->clip == _UG_CLIP_PART && (x < gui->clip.xs || x > gui->clip.xe || y < gui->clip.ys || y > gui->clip.ye) ) return;
+   s->p[s->count].x = x;
+   s->p[s->count].y = y;
+   if ( ++s->count == UG_PIXEL_BATCH ) _UG_PixelFlush(s);
 }
 
-/* -------------------------------------------------------------------------------- */
-/* -- DRIVER FUNCTIONS                                                           -- */
-/* -------------------------------------------------------------------------------- */
 void UG_DriverRegister( UG_U8 type, void* driver )
 {
    if ( type >= NUMBER_OF_DRIVERS ) return;
@@ -1501,18 +2298,125 @@ void UG_WaitForUpdate( void )
 }
 
 void UG_DrawBMP( UG_S16 xp, UG_S16 yp, UG_BMP* bmp )
+{
+   UG_DrawBMPArea(xp, yp, bmp, 0, 0, bmp->width-1, bmp->height-1);
+}
+
+/* Palette index of pixel x in a row of an indexed bitmap */
+static UG_U8 _UG_BMPIndex( const UG_U8* row, UG_U16 x, UG_U8 bpp )
+{
+   UG_U16 bit = x * bpp;
+
+   return (row[bit >> 3] >> (8 - bpp - (bit & 7))) & ((1 << bpp) - 1);
+}
+
+/* Starts reading the pixels of a BMP_RLE or indexed bitmap */
+void UG_BMPReadInit( UG_BMP_READER* r, const UG_BMP* bmp )
+{
+   r->bmp = bmp;
+   r->p = (const UG_U16*)bmp->p;
+   r->left = 0;
+   r->x = 0;
+   r->y = 0;
+   r->run = 0;
+}
+
+/*
+ * Reads up to max pixels, returns the count.
+ * If r->run is set all of them are *pixels, else pixels points to the stored colors.
+ * Indexed bitmaps are always read as runs, up to the end of the row
+ */
+UG_U16 UG_BMPRead( UG_BMP_READER* r, UG_U16 max, const UG_U16** pixels )
+{
+   const UG_BMP* bmp = r->bmp;
+   UG_U16 n;
+
+   if ( bmp->palette )
+   {
+      const UG_U8 bpp = bmp->bpp;
+      const UG_U8* row = (const UG_U8*)bmp->p + (UG_U32)r->y * ((bmp->width * bpp + 7) >> 3);
+      UG_U16 x = r->x, end = bmp->width - x > max ? x + max : bmp->width;
+      UG_U8 i = _UG_BMPIndex(row, x, bpp);
+      UG_U8 same = i * (0xFF / ((1 << bpp) - 1));              // A byte full of this index
+
+      for ( x++; x < end; x++ )
+      {
+         if ( !((x * bpp) & 7) )
+         {
+            while ( end - x >= 8 / bpp && row[(x * bpp) >> 3] == same ) x += 8 / bpp;   // Whole bytes of the run at once
+            if ( x >= end ) break;
+         }
+         if ( _UG_BMPIndex(row, x, bpp) != i ) break;
+      }
+      n = x - r->x;
+      r->x = x;
+      if ( x == bmp->width )
+      {
+         r->x = 0;
+         r->y++;
+      }
+      r->run = 1;
+      *pixels = &bmp->palette[i];
+      return n;
+   }
+   if ( !r->left )
+   {
+      if ( r->run ) r->p++;                     // Skip the color of the last run
+      r->run = *r->p >> 15;
+      r->left = (*r->p++ & 0x7FFF) + 1;
+   }
+   n = r->left < max ? r->left : max;
+   r->left -= n;
+   *pixels = r->p;
+   if ( !r->run ) r->p += n;
+   return n;
+}
+
+/* Skips n pixels */
+void UG_BMPSkip( UG_BMP_READER* r, UG_U32 n )
+{
+   const UG_U16* px;
+
+   if ( r->bmp->palette )
+   {
+      n += (UG_U32)r->y * r->bmp->width + r->x;
+      r->y = n / r->bmp->width;
+      r->x = n % r->bmp->width;
+      return;
+   }
+   while ( n ) n -= UG_BMPRead(r, n > 0xFFFF ? 0xFFFF : n, &px);
+}
+
+/*
+ * Draws the part xs,ys - xe,ye of a bitmap at xp,yp, for sprite sheets and scrolling strips.
+ * The result is clipped, drivers get the visible part only
+ */
+void UG_DrawBMPArea( UG_S16 xp, UG_S16 yp, UG_BMP* bmp, UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye )
 {
    UG_COLOR c;
-   UG_S16 x,y;
+   UG_S16 x,y,x0,y0,x1,y1;
+   UG_U8 clip;
 
    if ( bmp->p == NULL ) return;
-
-   if ( bmp->bpp == BMP_BPP_1){
+   if ( xs < 0 ) { xp -= xs; xs = 0; }                  // Source area inside the bitmap
+   if ( ys < 0 ) { yp -= ys; ys = 0; }
+   if ( xe >= bmp->width ) xe = bmp->width-1;
+   if ( ye >= bmp->height ) ye = bmp->height-1;
+   if ( xe < xs || ye < ys ) return;
+
+   x0 = xp; y0 = yp; x1 = xp+xe-xs; y1 = yp+ye-ys;
+   clip = _UG_ClipTest(x0, y0, x1, y1);
+   if ( clip == _UG_CLIP_OUT ) return;
+   _UG_ClipArea(&x0, &y0, &x1, &y1);                    // Only the visible part is drawn
+   xs += x0-xp;
+   ys += y0-yp;
+
+   if ( bmp->bpp == BMP_BPP_1 && bmp->palette == NULL ){
      UG_U8 xx,yy,b;
      const UG_U8* p = (UG_U8*)bmp->p;         // This is untested !
-      for(y=0;y<bmp->height;y++)
+      for(y=ys;y<=ys+y1-y0;y++)
       {
-         for(x=0;x<bmp->width;x++)
+         for(x=xs;x<=xs+x1-x0;x++)
          {
             yy = y / 8 ;
             xx = y % 8;
@@ -1521,53 +2425,94 @@ void UG_DrawBMP( UG_S16 xp, UG_S16 yp, UG_BMP* bmp )
             xx = xx & b;
             if(xx) c = gui->fore_color;
             else c = gui->back_color;
-            UG_DrawPixel( x + xp , y + yp , c );
+            gui->device->pset( x0+x-xs , y0+y-ys , c );
          }
       }
      return;
    }
    #if defined UGUI_USE_COLOR_RGB888 || defined UGUI_USE_COLOR_RGB565
-   else if ( bmp->bpp == BMP_BPP_16){
+   else if ( bmp->bpp == BMP_BPP_16 || bmp->palette ){
+     const UG_U16 *p;
+     void(*push_pixels)(UG_SIZE, UG_COLOR) = NULL;
+     #ifdef UGUI_USE_COLOR_RGB888
+     UG_U32 rgb[UG_PIXEL_BATCH];
+     #endif
+     UG_S16 n,i;
 
      /* Is hardware acceleration available? */
 
-      if ( gui->driver[DRIVER_DRAW_BMP].state & DRIVER_ENABLED)
+      if ( clip == _UG_CLIP_IN && x0 == xp && y0 == yp && x1-x0 == bmp->width-1 && y1-y0 == bmp->height-1 && bmp->bpp == BMP_BPP_16 && !(bmp->colors & BMP_RLE) && (gui->driver[DRIVER_DRAW_BMP].state & DRIVER_ENABLED) )
       {
         ((void(*)(UG_S16, UG_S16, UG_BMP* bmp))gui->driver[DRIVER_DRAW_BMP].driver)(xp,yp, bmp);
         return;
       }
-      else if ( gui->driver[DRIVER_FILL_AREA].state & DRIVER_ENABLED)
+      if ( gui->driver[DRIVER_BLIT].state & DRIVER_ENABLED )
       {
-         void(*push_pixels)(UG_U16, UG_COLOR) = ((void*(*)(UG_S16, UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_FILL_AREA].driver)(xp,yp,xp+bmp->width-1,yp+bmp->height-1);
-         UG_U16 *p = (UG_U16*)bmp->p;
-         for(y=0;y<bmp->height;y++)
-         {
-           for(x=0;x<bmp->width;x++)
+        if( ((UG_RESULT(*)(UG_S16, UG_S16, UG_BMP*, UG_S16, UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_BLIT].driver)(x0, y0, bmp, xs, ys, xs+x1-x0, ys+y1-y0) == UG_RESULT_OK ) return;
+      }
+      if ( gui->driver[DRIVER_FILL_AREA].state & DRIVER_ENABLED)
+      {
+         push_pixels = ((void*(*)(UG_S16, UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_FILL_AREA].driver)(x0,y0,x1,y1);
+      }
+
+     if ( (bmp->colors & BMP_RLE) || bmp->palette )
+     {
+        UG_BMP_READER r;
+        const UG_U16* px;
+
+        UG_BMPReadInit(&r, bmp);
+        UG_BMPSkip(&r, (UG_U32)ys*bmp->width + xs);
+        for(y=y0;y<=y1;y++)
+        {
+           for(x=x0;x<=x1;x+=n)
            {
-             #ifdef UGUI_USE_COLOR_RGB888
-             push_pixels(1, _UG_ConvertRGB565ToRGB888(*p++)); /* Convert RGB565 to RGB888 */
-             #elif defined UGUI_USE_COLOR_RGB565
-             push_pixels(1, *p++);
-             #endif
+              n = UG_BMPRead(&r, x1-x+1, &px);
+              for(i=0;i<n;i++)
+              {
+                 #ifdef UGUI_USE_COLOR_RGB888
+                 c = _UG_ConvertRGB565ToRGB888(px[r.run ? 0 : i]);
+                 #else
+                 c = px[r.run ? 0 : i];
+                 #endif
+                 if ( push_pixels && r.run )
+                 {
+                    push_pixels(n, c);                          // Runs are sent as fills
+                    break;
+                 }
+                 if ( push_pixels ) push_pixels(1, c);
+                 else gui->device->pset( x+i , y , c );
+              }
            }
-           yp++;
-         }
-         return;
-      }
+           if ( y < y1 ) UG_BMPSkip(&r, bmp->width-(x1-x0+1));
+        }
+        if ( push_pixels ) ((void*(*)(UG_S16, UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_FILL_AREA].driver)(-1,-1,-1,-1);   // -1 to indicate finish
+        return;
+     }
 
-     UG_U16 *p = (UG_U16*)bmp->p;
-     for(y=0;y<bmp->height;y++)
+     p = (const UG_U16*)bmp->p + (UG_U32)ys*bmp->width + xs;   // First visible pixel
+     for(y=y0;y<=y1;y++)
      {
-        for(x=0;x<bmp->width;x++)
+        for(x=0;x<=x1-x0;x+=n)
         {
-          #ifdef UGUI_USE_COLOR_RGB888
-           UG_DrawPixel( xp+x , yp , _UG_ConvertRGB565ToRGB888(*p++) ); /* Convert RGB565 to RGB888 */
-          #elif defined UGUI_USE_COLOR_RGB565
-           UG_DrawPixel( xp+x , yp , *p++ );
-          #endif
+           n = x1-x0+1-x<UG_PIXEL_BATCH ? x1-x0+1-x : UG_PIXEL_BATCH;
+           #ifdef UGUI_USE_COLOR_RGB888
+           UG_KernelRGB565To888(rgb, p+x, n);                 /* Convert RGB565 to RGB888 */
+           for(i=0;i<n;i++)
+           {
+              if ( push_pixels ) push_pixels(1, rgb[i]);
+              else gui->device->pset( x0+x+i , y , rgb[i] );
+           }
+           #elif defined UGUI_USE_COLOR_RGB565
+           for(i=0;i<n;i++)
+           {
+              if ( push_pixels ) push_pixels(1, p[x+i]);
+              else gui->device->pset( x0+x+i , y , p[x+i] );
+           }
+           #endif
         }
-        yp++;
+        p += bmp->width;
      }
+     if ( push_pixels ) ((void*(*)(UG_S16, UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_FILL_AREA].driver)(-1,-1,-1,-1);   // -1 to indicate finish
    }
    #endif
 }
@@ -1828,7 +2773,7 @@ UG_RESULT UG_WindowSetTitleTextFont( UG_WINDOW* wnd, UG_FONT* font )
       wnd->title.font = font;
       if ( wnd->title.height <= (UG_GetFontHeight(font) + 1) )
       {
-         wnd->title.height = UG_GetFontWidth(font) + 2;
+         wnd->title.height = UG_GetFontHeight(font) + 2;
          wnd->state &= ~WND_STATE_REDRAW_TITLE;
       }
       return UG_RESULT_OK;
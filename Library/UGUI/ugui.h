@@ -56,8 +56,8 @@ typedef UG_U8                        UG_COLOR;
 /* -- DEFINES                                                                    -- */
 /* -------------------------------------------------------------------------------- */
 /* Internal helpers */
-#define UG_GetFontWidth(f)                            *(f+1)
-#define UG_GetFontHeight(f)                           *(f+2)
+#define UG_GetFontWidth(f)                            *(f+0)
+#define UG_GetFontHeight(f)                           *(f+1)
 #define swap(a, b)                                    { UG_U16 t=a; a=b; b=t; }
 
 /* Sizing helpers */
@@ -119,10 +119,33 @@ typedef enum
   FONT_TYPE_8BPP
 } FONT_TYPE;
 
+/*
+  Run length encoded 1BPP fonts (flags bit 5). Bytes per char is 0, the data starts with a 16 bit offset per char,
+  relative to the end of that table. Each glyph byte holds a background run (high nibble) followed by a foreground run
+  (low nibble), scanning the rows of the actual char width. Longer runs continue in the next byte with the other run at 0.
+  Use Tools/ugui_font_rle.c to convert a font.
+*/
+
+/* Offset table entries indexed at font selection, fonts with more use a linear scan */
+#define UG_FONT_RANGES                                16
+/* Glyph lookup cache entries, power of 2 */
+#define UG_GLYPH_CACHE                                8
+/* Slots of the blended 8BPP glyph cache, the RAM is set by UGUI_GLYPH_BLEND_CACHE */
+#define UG_GLYPH_BLEND_SLOTS                          16
+
+/* Consecutive chars stored one after another in the font data */
+typedef struct
+{
+   UG_U16       start;
+   UG_U16       stop;
+   UG_U16       skip;                             // Glyphs before this range
+} UG_FONT_RANGE;
+
 typedef struct
 {
    FONT_TYPE    font_type;
    UG_U8        is_old_font;                      // This exists to maintain compatibility with old fonts, as they use code page 850 instead of Unicode
+   UG_U8        is_rle;                           // Glyphs stored as runs
    UG_U8        char_width;
    UG_U8        char_height;
    UG_U16       bytes_per_char;
@@ -132,6 +155,8 @@ typedef struct
    const UG_U8  * offsets;
    const UG_U8  * data;
    UG_FONT      * font;
+   UG_FONT_RANGE ranges[UG_FONT_RANGES];          // Sorted, binary searched
+   UG_U8        range_count;                      // 0: offset table too big, not indexed
 } UG_FONT_DATA;
 
 #ifdef UGUI_USE_UTF8
@@ -176,6 +201,7 @@ typedef struct
    const UG_U16 height;
    const UG_U8 bpp;
    const UG_U8 colors;
+   const UG_U16* palette;                       // RGB565 colors of an indexed bitmap, NULL for direct color
 } UG_BMP;
 
 #define BMP_BPP_1                                     (1<<0)
@@ -187,6 +213,29 @@ typedef struct
 #define BMP_RGB888                                    (1<<0)
 #define BMP_RGB565                                    (1<<1)
 #define BMP_RGB555                                    (1<<2)
+#define BMP_RLE                                       (1<<6)  // Run length encoded, BMP_BPP_16 only. Convert with Tools/ugui_bmp_rle.c
+#define BMP_RAM                                       (1<<7)  // Data may change after the draw call, drivers can't keep a reference
+
+/*
+  BMP_RLE data is a list of RGB565 packets, the rows follow each other and a packet can cross rows:
+    1nnnnnnn nnnnnnnn, color              n+1 pixels of the same color
+    0nnnnnnn nnnnnnnn, n+1 colors         n+1 pixels stored as they are
+
+  Indexed bitmaps (BMP_BPP_1/2/4/8 with a palette) store one palette index per pixel.
+  Each row starts on a new byte, the leftmost pixel is in the high bits. Convert with Tools/ugui_bmp_index.c
+  A BMP_BPP_1 bitmap without palette is drawn with the fore and back colors, 8 rows per byte.
+*/
+
+/* Reads BMP_RLE and indexed bitmaps as runs of pixels */
+typedef struct
+{
+   const UG_BMP* bmp;
+   const UG_U16* p;                             // BMP_RLE: current packet
+   UG_U16 left;                                 // BMP_RLE: pixels left in the current packet
+   UG_U16 x;                                    // Indexed: next pixel
+   UG_U16 y;
+   UG_U8 run;                                   // Last read was a run, pixels points to its color
+} UG_BMP_READER;
 
 /* -------------------------------------------------------------------------------- */
 /* -- MESSAGE                                                                    -- */
@@ -341,15 +390,47 @@ typedef struct
   UG_U8 state;
 } UG_DRIVER;
 
+/* Horizontal run for DRIVER_FILL_SPANS, xs <= xe */
+typedef struct
+{
+   UG_S16 y;
+   UG_S16 xs;
+   UG_S16 xe;
+   UG_COLOR c;
+} UG_SPAN;
+
+/* Pixel for DRIVER_DRAW_PIXELS */
+typedef struct
+{
+   UG_S16 x;
+   UG_S16 y;
+} UG_POINT;
+
 #define DRIVER_REGISTERED                             (1<<0)
 #define DRIVER_ENABLED                                (1<<1)
 
 /* Supported drivers */
-#define NUMBER_OF_DRIVERS                             4
+#define NUMBER_OF_DRIVERS                             8
 #define DRIVER_DRAW_LINE                              0
 #define DRIVER_FILL_FRAME                             1
 #define DRIVER_FILL_AREA                              2
 #define DRIVER_DRAW_BMP                               3
+#define DRIVER_FILL_SPANS                             4     /* UG_RESULT fill_spans(const UG_SPAN* spans, UG_U16 count) */
+#define DRIVER_DRAW_PIXELS                            5     /* UG_RESULT draw_pixels(UG_POINT* p, UG_U16 count, UG_COLOR c), may reorder p */
+#define DRIVER_BLIT                                   6     /* UG_RESULT blit(UG_S16 x, UG_S16 y, UG_BMP* bmp, UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye), visible part of a bitmap */
+#define DRIVER_VSCROLL                                7     /* UG_RESULT vscroll(UG_S16 ys, UG_S16 ye, UG_S16 top), rows ys-ye shown from row top, wrapping. -1 ends scrolling */
+
+/* Spans collected on the stack by the filled primitives before calling DRIVER_FILL_SPANS */
+#define UG_SPAN_BATCH                                 16
+/* Pixels collected by the outline primitives before calling DRIVER_DRAW_PIXELS */
+#define UG_PIXEL_BATCH                                32
+/* Chars of a text line sent in a single FILL_AREA window, longer lines are split */
+#define UG_TEXT_LINE_CHARS                            32
+/* Lines kept by the text layout, and number of layouts cached */
+#define UG_TEXT_LAYOUT_LINES                          8
+#define UG_TEXT_LAYOUT_CACHE                          4
+/* Nested clip rectangles kept by UG_PushClip */
+#define UG_CLIP_DEPTH                                 4
 
 /* -------------------------------------------------------------------------------- */
 /* -- µGUI CORE STRUCTURE                                                        -- */
@@ -388,6 +469,9 @@ typedef struct
       UG_S16 y_end;
       UG_COLOR fore_color;
       UG_COLOR back_color;
+      UG_S16 scroll_end;                        // Last row of the hardware scroll area, -1 if not scrolling
+      UG_S16 scroll_top;                        // Row shown at the top of the area, -1 until the area is full
+      UG_U8 scroll;                             // Hardware scroll requested with UG_ConsoleSetScroll()
    } console;
    #endif
    UG_FONT *font;
@@ -400,6 +484,9 @@ typedef struct
    UG_COLOR desktop_color;
    UG_U8 state;
    UG_DRIVER driver[NUMBER_OF_DRIVERS];
+   UG_AREA clip;                                      // Drawing is limited to this area, the screen by default
+   UG_AREA clip_stack[UG_CLIP_DEPTH];
+   UG_U8 clip_depth;
 } UG_GUI;
 
 #define UG_STATUS_WAIT_FOR_UPDATE                     (1<<0)
@@ -408,6 +495,7 @@ typedef struct
 #include "ugui_checkbox.h"
 #include "ugui_fonts.h"
 #include "ugui_image.h"
+#include "ugui_kernel.h"
 #include "ugui_progress.h"
 #include "ugui_textbox.h"
 /* -------------------------------------------------------------------------------- */
@@ -417,6 +505,8 @@ typedef struct
 UG_S16 UG_Init( UG_GUI* g, UG_DEVICE *device );
 UG_S16 UG_SelectGUI( UG_GUI* g );
 UG_GUI* UG_GetGUI( void );
+UG_RESULT UG_PushClip( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye );
+UG_RESULT UG_PopClip( void );
 
 void UG_FontSelect( UG_FONT* font );
 void UG_FillScreen( UG_COLOR c );
@@ -439,6 +529,7 @@ void UG_ConsolePutString( char* str );
 void UG_ConsoleSetArea( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye );
 void UG_ConsoleSetForecolor( UG_COLOR c );
 void UG_ConsoleSetBackcolor( UG_COLOR c );
+void UG_ConsoleSetScroll( UG_U8 enable );
 #endif
 void UG_SetForecolor( UG_COLOR c );
 void UG_SetBackcolor( UG_COLOR c );
@@ -448,11 +539,19 @@ void UG_FontSetHSpace( UG_U16 s );
 void UG_FontSetVSpace( UG_U16 s );
 void UG_FontSetTransparency( UG_U8 t );
 UG_U8 UG_FontGetTransparency( void );
+#if defined(UGUI_GLYPH_BLEND_CACHE) && defined(UGUI_USE_COLOR_RGB565)
+void UG_GlyphCacheStats( UG_U32* hits, UG_U32* misses );
+void UG_GlyphCacheClear( void );
+#endif
 
 /* Miscellaneous functions */
 void UG_WaitForUpdate( void );
 void UG_Update( void );
 void UG_DrawBMP( UG_S16 xp, UG_S16 yp, UG_BMP* bmp );
+void UG_DrawBMPArea( UG_S16 xp, UG_S16 yp, UG_BMP* bmp, UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye );
+void UG_BMPReadInit( UG_BMP_READER* r, const UG_BMP* bmp );
+UG_U16 UG_BMPRead( UG_BMP_READER* r, UG_U16 max, const UG_U16** pixels );
+void UG_BMPSkip( UG_BMP_READER* r, UG_U32 n );
 #ifdef UGUI_USE_TOUCH
 void UG_TouchUpdate( UG_S16 xp, UG_S16 yp, UG_U8 state );
 #endif
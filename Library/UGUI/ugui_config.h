@@ -63,12 +63,16 @@
 #define UGUI_USE_FONT_arial_45X52_CYRILLIC
 #define UGUI_USE_FONT_arial_49X57
 #define UGUI_USE_FONT_arial_49X57_CYRILLIC
+#define UGUI_USE_FONT_arial_49X57_RLE
 
 /* Feature enablers */
 // #define UGUI_USE_PRERENDER_EVENT
 // #define UGUI_USE_POSTRENDER_EVENT
 // #define UGUI_USE_MULTITASKING
 
+/* RAM in bytes for pre-blended 8BPP glyphs, drawn with the DRAW_BMP driver. RGB565 only */
+// #define UGUI_GLYPH_BLEND_CACHE  4096
+
 /* Specify platform-dependent types here */
 
 typedef uint8_t      UG_U8;
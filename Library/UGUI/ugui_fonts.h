@@ -152,4 +152,9 @@ extern UG_FONT FONT_arial_49X57[];
 extern UG_FONT FONT_arial_49X57_CYRILLIC[];
 #endif
 
+/* Run length encoded, see Tools/ugui_font_rle.c */
+#ifdef UGUI_USE_FONT_arial_49X57_RLE
+extern UG_FONT FONT_arial_49X57_RLE[];
+#endif
+
 #endif // __UGUI_FONTS_DATA_H
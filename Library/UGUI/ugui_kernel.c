@@ -0,0 +1,257 @@
+#include "ugui_kernel.h"
+
+#if defined(UG_KERNEL_DSP)
+#include "cmsis_compiler.h"
+#elif defined(UG_KERNEL_SSE2)
+#include <emmintrin.h>
+#endif
+
+/* -------------------------------------------------------------------------------- */
+/* -- PORTABLE KERNELS                                                           -- */
+/* -------------------------------------------------------------------------------- */
+
+void UG_KernelFill16_C( UG_U16* dst, UG_U16 c, UG_U32 n )
+{
+   while ( n >= 4 )                                            // Unrolled, the compiler merges these into word stores
+   {
+      dst[0] = c;
+      dst[1] = c;
+      dst[2] = c;
+      dst[3] = c;
+      dst += 4;
+      n -= 4;
+   }
+   while ( n-- )
+   {
+      *dst++ = c;
+   }
+}
+
+UG_U16 UG_KernelBlendPixel565( UG_U16 fc, UG_U16 bc, UG_U8 a )
+{
+   UG_U32 a6 = ((UG_U32)a + 2) >> 2;
+   UG_U32 rb, g;
+
+   /* Red and blue are blended together, 16 bits apart */
+   rb = ((((UG_U32)(fc & 0xF800) << 5) | (fc & 0x1F)) * a6 + (((UG_U32)(bc & 0xF800) << 5) | (bc & 0x1F)) * (64 - a6)) >> 6;
+   g = ((UG_U32)(fc & 0x7E0) * a6 + (UG_U32)(bc & 0x7E0) * (64 - a6)) >> 6;
+   return ((rb >> 5) & 0xF800) | (g & 0x7E0) | (rb & 0x1F);
+}
+
+void UG_KernelBlend565_C( UG_U16* dst, const UG_U8* a, UG_U32 n, UG_U16 fc, UG_U16 bc )
+{
+   while ( n-- )
+   {
+      *dst++ = UG_KernelBlendPixel565(fc, bc, *a++);
+   }
+}
+
+UG_U32 UG_KernelPixelRGB565To888( UG_U16 c )
+{
+   UG_U32 r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+
+   r = (r << 3) | (r >> 2);
+   g = (g << 2) | (g >> 4);
+   b = (b << 3) | (b >> 2);
+   return (r << 16) | (g << 8) | b;
+}
+
+void UG_KernelRGB565To888_C( UG_U32* dst, const UG_U16* src, UG_U32 n )
+{
+   while ( n-- )
+   {
+      *dst++ = UG_KernelPixelRGB565To888(*src++);
+   }
+}
+
+#if defined(UG_KERNEL_DSP)
+/* -------------------------------------------------------------------------------- */
+/* -- CORTEX-M DSP KERNELS                                                       -- */
+/* -------------------------------------------------------------------------------- */
+
+void UG_KernelFill16( UG_U16* dst, UG_U16 c, UG_U32 n )
+{
+   UG_U32 c2 = __PKHBT(c, c, 16);
+
+   if ( n && ((uintptr_t)dst & 2) )                            // Align for word stores
+   {
+      *dst++ = c;
+      n--;
+   }
+   while ( n >= 8 )
+   {
+      ((UG_U32*)dst)[0] = c2;
+      ((UG_U32*)dst)[1] = c2;
+      ((UG_U32*)dst)[2] = c2;
+      ((UG_U32*)dst)[3] = c2;
+      dst += 8;
+      n -= 8;
+   }
+   while ( n >= 2 )
+   {
+      *(UG_U32*)dst = c2;
+      dst += 2;
+      n -= 2;
+   }
+   if ( n ) *dst = c;
+}
+
+/* Both colors are split in channels, foreground in the low halfword, so SMUAD blends a channel in one step */
+static inline UG_U16 _UG_KernelBlendDSP( UG_U32 rr, UG_U32 gg, UG_U32 bb, UG_U8 a )
+{
+   UG_U32 a6 = ((UG_U32)a + 2) >> 2;
+   UG_U32 aa = __PKHBT(a6, 64 - a6, 16);
+
+   return ((__SMUAD(rr, aa) >> 6) << 11) | ((__SMUAD(gg, aa) >> 6) << 5) | (__SMUAD(bb, aa) >> 6);
+}
+
+void UG_KernelBlend565( UG_U16* dst, const UG_U8* a, UG_U32 n, UG_U16 fc, UG_U16 bc )
+{
+   UG_U32 rr = __PKHBT(fc >> 11, bc >> 11, 16);
+   UG_U32 gg = __PKHBT((fc >> 5) & 0x3F, (bc >> 5) & 0x3F, 16);
+   UG_U32 bb = __PKHBT(fc & 0x1F, bc & 0x1F, 16);
+   UG_U32 fc2 = __PKHBT(fc, fc, 16);
+   UG_U32 bc2 = __PKHBT(bc, bc, 16);
+   UG_U32 a4, lo, hi;
+
+   if ( n && ((uintptr_t)dst & 2) )
+   {
+      *dst++ = _UG_KernelBlendDSP(rr, gg, bb, *a++);
+      n--;
+   }
+   while ( n >= 4 )
+   {
+      a4 = __UNALIGNED_UINT32_READ(a);
+      __USUB8(a4, 0x80808080);                                 // GE flags set for the bytes >= 0x80
+      if ( __SEL(0xFFFFFFFF, 0) == a4 )                        // Every coverage is 0 or 255, select the colors
+      {
+         lo = __UXTB16(a4);                                    // a0, a2
+         hi = __UXTB16(__ROR(a4, 8));                          // a1, a3
+         __USUB16(__PKHBT(lo, hi, 16), 0x00800080);
+         ((UG_U32*)dst)[0] = __SEL(fc2, bc2);
+         __USUB16(__PKHTB(hi, lo, 16), 0x00800080);
+         ((UG_U32*)dst)[1] = __SEL(fc2, bc2);
+      }
+      else
+      {
+         dst[0] = _UG_KernelBlendDSP(rr, gg, bb, a[0]);
+         dst[1] = _UG_KernelBlendDSP(rr, gg, bb, a[1]);
+         dst[2] = _UG_KernelBlendDSP(rr, gg, bb, a[2]);
+         dst[3] = _UG_KernelBlendDSP(rr, gg, bb, a[3]);
+      }
+      dst += 4;
+      a += 4;
+      n -= 4;
+   }
+   while ( n-- )
+   {
+      *dst++ = _UG_KernelBlendDSP(rr, gg, bb, *a++);
+   }
+}
+
+void UG_KernelRGB565To888( UG_U32* dst, const UG_U16* src, UG_U32 n )
+{
+   UG_U32 w, r, g, b;
+
+   while ( n >= 2 )                                            // Two pixels at a time, one per halfword
+   {
+      w = __UNALIGNED_UINT32_READ(src);
+      r = (w >> 11) & 0x001F001F;
+      g = (w >> 5) & 0x003F003F;
+      b = w & 0x001F001F;
+      r = (r << 3) | ((r >> 2) & 0x00070007);
+      g = (g << 2) | ((g >> 4) & 0x00030003);
+      b = (b << 3) | ((b >> 2) & 0x00070007);
+      dst[0] = __PKHBT(b, r, 16) | ((g & 0xFF) << 8);
+      dst[1] = __PKHTB(r, b, 16) | ((g >> 8) & 0xFF00);
+      dst += 2;
+      src += 2;
+      n -= 2;
+   }
+   if ( n ) *dst = UG_KernelPixelRGB565To888(*src);
+}
+
+#elif defined(UG_KERNEL_SSE2)
+/* -------------------------------------------------------------------------------- */
+/* -- SSE2 KERNELS                                                               -- */
+/* -------------------------------------------------------------------------------- */
+
+void UG_KernelFill16( UG_U16* dst, UG_U16 c, UG_U32 n )
+{
+   __m128i v = _mm_set1_epi16((short)c);
+
+   while ( n >= 8 )
+   {
+      _mm_storeu_si128((__m128i*)dst, v);
+      dst += 8;
+      n -= 8;
+   }
+   UG_KernelFill16_C(dst, c, n);
+}
+
+void UG_KernelBlend565( UG_U16* dst, const UG_U8* a, UG_U32 n, UG_U16 fc, UG_U16 bc )
+{
+   const __m128i zero = _mm_setzero_si128();
+   const __m128i rf = _mm_set1_epi16(fc >> 11), rb = _mm_set1_epi16(bc >> 11);
+   const __m128i gf = _mm_set1_epi16((fc >> 5) & 0x3F), gb = _mm_set1_epi16((bc >> 5) & 0x3F);
+   const __m128i bf = _mm_set1_epi16(fc & 0x1F), bb = _mm_set1_epi16(bc & 0x1F);
+   __m128i a6, ia, r, g, b;
+
+   while ( n >= 8 )
+   {
+      a6 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)a), zero);
+      a6 = _mm_srli_epi16(_mm_add_epi16(a6, _mm_set1_epi16(2)), 2);
+      ia = _mm_sub_epi16(_mm_set1_epi16(64), a6);
+      r = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(rf, a6), _mm_mullo_epi16(rb, ia)), 6);
+      g = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(gf, a6), _mm_mullo_epi16(gb, ia)), 6);
+      b = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(bf, a6), _mm_mullo_epi16(bb, ia)), 6);
+      _mm_storeu_si128((__m128i*)dst, _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b));
+      dst += 8;
+      a += 8;
+      n -= 8;
+   }
+   UG_KernelBlend565_C(dst, a, n, fc, bc);
+}
+
+void UG_KernelRGB565To888( UG_U32* dst, const UG_U16* src, UG_U32 n )
+{
+   const __m128i m5 = _mm_set1_epi16(0x1F), m6 = _mm_set1_epi16(0x3F);
+   __m128i v, r, g, b;
+
+   while ( n >= 8 )
+   {
+      v = _mm_loadu_si128((const __m128i*)src);
+      r = _mm_srli_epi16(v, 11);
+      g = _mm_and_si128(_mm_srli_epi16(v, 5), m6);
+      b = _mm_and_si128(v, m5);
+      r = _mm_or_si128(_mm_slli_epi16(r, 3), _mm_srli_epi16(r, 2));
+      g = _mm_or_si128(_mm_slli_epi16(g, 2), _mm_srli_epi16(g, 4));
+      b = _mm_or_si128(_mm_slli_epi16(b, 3), _mm_srli_epi16(b, 2));
+      b = _mm_or_si128(b, _mm_slli_epi16(g, 8));                // Green and blue in the low halfword, red in the high one
+      _mm_storeu_si128((__m128i*)dst, _mm_unpacklo_epi16(b, r));
+      _mm_storeu_si128((__m128i*)(dst + 4), _mm_unpackhi_epi16(b, r));
+      dst += 8;
+      src += 8;
+      n -= 8;
+   }
+   UG_KernelRGB565To888_C(dst, src, n);
+}
+
+#else
+
+void UG_KernelFill16( UG_U16* dst, UG_U16 c, UG_U32 n )
+{
+   UG_KernelFill16_C(dst, c, n);
+}
+
+void UG_KernelBlend565( UG_U16* dst, const UG_U8* a, UG_U32 n, UG_U16 fc, UG_U16 bc )
+{
+   UG_KernelBlend565_C(dst, a, n, fc, bc);
+}
+
+void UG_KernelRGB565To888( UG_U32* dst, const UG_U16* src, UG_U32 n )
+{
+   UG_KernelRGB565To888_C(dst, src, n);
+}
+
+#endif
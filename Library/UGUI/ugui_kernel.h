@@ -0,0 +1,39 @@
+#ifndef __UGUI_KERNEL_H
+#define __UGUI_KERNEL_H
+
+#include "ugui.h"
+
+/* -------------------------------------------------------------------------------- */
+/* -- PIXEL KERNELS                                                              -- */
+/* -------------------------------------------------------------------------------- */
+
+/*
+  Color math over pixel rows. Cortex-M4/M7 use the DSP instructions, x86 hosts SSE2, anything else plain C.
+  The _C versions are always built, every other version returns exactly the same pixels.
+
+  Blending uses 6 bit coverage: a6 = (a+2)>>2, channel = (fc*a6 + bc*(64-a6)) >> 6.
+  RGB565 to RGB888 replicates the top bits of each channel, so 0x1F becomes 0xFF.
+*/
+
+/* Kernels built for this target */
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define UG_KERNEL_DSP
+#elif defined(__SSE2__)
+#define UG_KERNEL_SSE2
+#endif
+
+/* Fills n pixels with the same color */
+void UG_KernelFill16( UG_U16* dst, UG_U16 c, UG_U32 n );
+void UG_KernelFill16_C( UG_U16* dst, UG_U16 c, UG_U32 n );
+
+/* Blends fc over bc with an 8 bit coverage per pixel, RGB565 */
+UG_U16 UG_KernelBlendPixel565( UG_U16 fc, UG_U16 bc, UG_U8 a );
+void UG_KernelBlend565( UG_U16* dst, const UG_U8* a, UG_U32 n, UG_U16 fc, UG_U16 bc );
+void UG_KernelBlend565_C( UG_U16* dst, const UG_U8* a, UG_U32 n, UG_U16 fc, UG_U16 bc );
+
+/* Converts RGB565 pixels to RGB888 */
+UG_U32 UG_KernelPixelRGB565To888( UG_U16 c );
+void UG_KernelRGB565To888( UG_U32* dst, const UG_U16* src, UG_U32 n );
+void UG_KernelRGB565To888_C( UG_U32* dst, const UG_U16* src, UG_U32 n );
+
+#endif